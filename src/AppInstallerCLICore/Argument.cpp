@@ -311,6 +311,10 @@ namespace AppInstaller::CLI
             return { type, "output"_liv, 'o' };
         case Execution::Args::Type::Correlation:
             return { type, "correlation"_liv };
+        case Execution::Args::Type::Timings:
+            return { type, "timings"_liv };
+        case Execution::Args::Type::TimingsOutput:
+            return { type, "timings-output"_liv };
 
         case Execution::Args::Type::DependencySource:
             return { type, "dependency-source"_liv, ArgTypeCategory::ExtendedSource };
@@ -506,6 +510,10 @@ namespace AppInstaller::CLI
             return Argument{ type, Resource::String::FontDetailsArgumentDescription, ArgumentType::Flag, false };
         case Args::Type::Correlation:
             return Argument{ type, Resource::String::CorrelationArgumentDescription, ArgumentType::Standard, Argument::Visibility::Hidden };
+        case Args::Type::Timings:
+            return Argument{ type, Resource::String::TimingsArgumentDescription, ArgumentType::Flag, Argument::Visibility::Help };
+        case Args::Type::TimingsOutput:
+            return Argument{ type, Resource::String::TimingsOutputArgumentDescription, ArgumentType::Standard, Argument::Visibility::Help };
         case Args::Type::ListDetails:
             return Argument{ type, Resource::String::ListDetailsArgumentDescription, ArgumentType::Flag, Argument::Visibility::Help };
         default:
@@ -528,6 +536,8 @@ namespace AppInstaller::CLI
         args.push_back(ForType(Args::Type::Proxy));
         args.push_back(ForType(Args::Type::NoProxy));
         args.push_back(ForType(Args::Type::Correlation));
+        args.push_back(ForType(Args::Type::Timings));
+        args.push_back(ForType(Args::Type::TimingsOutput));
     }
 
     std::string Argument::GetUsageString() const
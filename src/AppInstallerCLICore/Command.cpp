@@ -4,11 +4,13 @@
 #include "Command.h"
 #include "Resources.h"
 #include "Sixel.h"
+#include "TableOutput.h"
 #include <winget/UserSettings.h>
 #include <AppInstallerRuntime.h>
 #include <winget/Locale.h>
 #include <winget/Reboot.h>
 #include <winget/Authentication.h>
+#include <winget/Timing.h>
 
 using namespace std::string_view_literals;
 using namespace AppInstaller::Utility::literals;
@@ -33,6 +35,53 @@ namespace AppInstaller::CLI
             }
             CATCH_LOG();
         }
+
+        std::string FormatMilliseconds(std::chrono::nanoseconds duration)
+        {
+            std::ostringstream stream;
+            stream << std::fixed << std::setprecision(1) << std::chrono::duration<double, std::milli>(duration).count();
+            return stream.str();
+        }
+
+        void ReportTimingsIfRequested(Execution::Context& context)
+        {
+            try
+            {
+                if (!Timing::IsEnabled())
+                {
+                    return;
+                }
+
+                std::vector<Timing::PhaseSummary> summaries = Timing::GetSummary();
+                for (const auto& summary : summaries)
+                {
+                    AICLI_LOG(CLI, Info, << "Timing for " << Timing::ToString(summary.Phase) << ": count " << summary.Count <<
+                        ", total " << FormatMilliseconds(summary.Total) << "ms, longest " << FormatMilliseconds(summary.Maximum) << "ms");
+                }
+
+                if (context.Args.Contains(Execution::Args::Type::Timings))
+                {
+                    Execution::TableOutput<4> table{ context.Reporter, { Resource::String::TimingsPhase, Resource::String::TimingsCount, Resource::String::TimingsTotal, Resource::String::TimingsMaximum } };
+
+                    for (const auto& summary : summaries)
+                    {
+                        table.OutputLine({ std::string{ Timing::ToString(summary.Phase) }, std::to_string(summary.Count), FormatMilliseconds(summary.Total), FormatMilliseconds(summary.Maximum) });
+                    }
+
+                    table.Complete();
+                }
+
+                if (context.Args.Contains(Execution::Args::Type::TimingsOutput))
+                {
+                    std::filesystem::path outputPath{ Utility::ConvertToUTF16(context.Args.GetArg(Execution::Args::Type::TimingsOutput)) };
+                    std::ofstream out{ outputPath };
+                    THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_OPEN_FAILED), !out);
+
+                    out << Timing::GetSummaryAsJson() << std::endl;
+                }
+            }
+            CATCH_LOG();
+        }
     }
 
     Command::Command(
@@ -1079,6 +1128,7 @@ namespace AppInstaller::CLI
     int Execute(Execution::Context& context, std::unique_ptr<Command>& command)
     {
         ExecuteWithoutLoggingSuccess(context, command.get());
+        ReportTimingsIfRequested(context);
 
         if (SUCCEEDED(context.GetTerminationHR()))
         {
@@ -42,9 +42,9 @@ namespace AppInstaller::CLI
             [](Execution::Context& context)
         {
             auto inputFile = context.Args.GetArg(Execution::Args::Type::HashFile);
-            std::ifstream inStream{ Utility::ConvertToUTF16(inputFile), std::ifstream::binary };
+            auto fileHash = Utility::SHA256::ComputeHashFromFile(Utility::ConvertToUTF16(inputFile));
 
-            context.Reporter.Info() << "InstallerSha256: "_liv << Utility::LocIndString{ Utility::SHA256::ConvertToString(Utility::SHA256::ComputeHash(inStream)) } << std::endl;
+            context.Reporter.Info() << "InstallerSha256: "_liv << Utility::LocIndString{ Utility::SHA256::ConvertToString(fileHash) } << std::endl;
 
             if (context.Args.Contains(Execution::Args::Type::Msix))
             {
@@ -116,7 +116,7 @@ namespace AppInstaller::CLI
 
         Logging::Log().SetEnabledChannels(Settings::User().Get<Settings::Setting::LoggingChannelPreference>());
         Logging::Log().SetLevel(Settings::User().Get<Settings::Setting::LoggingLevelPreference>());
-        Logging::FileLogger::Add();
+        Logging::FileLogger::AddWithBackgroundWriter(Logging::FileLogger::DefaultPrefix());
         Logging::OutputDebugStringLogger::Remove();
         Logging::EnableWilFailureTelemetry();
 
@@ -179,6 +179,8 @@ namespace AppInstaller::CLI::Execution
             Force, // Forces the execution of the workflow with non security related issues
             OutputFile,
             Correlation,
+            Timings, // Shows the time spent in each phase of the command
+            TimingsOutput, // Writes the time spent in each phase of the command to a JSON file
 
             DependencySource, // Index source to be queried against for finding dependencies
             CustomHeader, // Optional Rest source header
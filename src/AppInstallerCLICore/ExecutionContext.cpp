@@ -11,6 +11,7 @@
 #include <winget/Reboot.h>
 #include <winget/UserSettings.h>
 #include <winget/NetworkSettings.h>
+#include <winget/Timing.h>
 
 using namespace AppInstaller::Checkpoints;
 
@@ -113,6 +114,12 @@ namespace AppInstaller::CLI::Execution
             Logging::Log().SetLevel(Logging::Level::Verbose);
         }
 
+        // Collect timings if they will be reported
+        if (Args.Contains(Args::Type::Timings) || Args.Contains(Args::Type::TimingsOutput))
+        {
+            Timing::SetEnabled(true);
+        }
+
         // Disable warnings if requested
         if (Args.Contains(Args::Type::IgnoreWarnings))
         {
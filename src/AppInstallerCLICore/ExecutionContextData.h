@@ -6,6 +6,7 @@
 #include <winget/Manifest.h>
 #include <winget/ARPCorrelation.h>
 #include <winget/Authentication.h>
+#include <winget/Filesystem.h>
 #include <winget/Pin.h>
 #include <winget/PinningData.h>
 #include "CompletionData.h"
@@ -69,6 +70,8 @@ namespace AppInstaller::CLI::Execution
         RepairString,
         MsixDigests,
         InstallerDownloadAuthenticators,
+        // The identity of the installer file when its hash was verified.
+        InstallerFileIdentity,
         Max
     };
 
@@ -299,5 +302,11 @@ namespace AppInstaller::CLI::Execution
             // The authenticator map shared with sub contexts
             using value_t = std::shared_ptr<std::map<Authentication::AuthenticationInfo, Authentication::Authenticator>>;
         };
+
+        template<>
+        struct DataMapping<Data::InstallerFileIdentity>
+        {
+            using value_t = Filesystem::FileIdentity;
+        };
     }
 }
@@ -777,6 +777,12 @@ namespace AppInstaller::CLI::Resource
         WINGET_DEFINE_RESOURCE_STRINGID(TargetVersionArgumentDescription);
         WINGET_DEFINE_RESOURCE_STRINGID(ThankYou);
         WINGET_DEFINE_RESOURCE_STRINGID(ThirdPartSoftwareNotices);
+        WINGET_DEFINE_RESOURCE_STRINGID(TimingsArgumentDescription);
+        WINGET_DEFINE_RESOURCE_STRINGID(TimingsCount);
+        WINGET_DEFINE_RESOURCE_STRINGID(TimingsMaximum);
+        WINGET_DEFINE_RESOURCE_STRINGID(TimingsOutputArgumentDescription);
+        WINGET_DEFINE_RESOURCE_STRINGID(TimingsPhase);
+        WINGET_DEFINE_RESOURCE_STRINGID(TimingsTotal);
         WINGET_DEFINE_RESOURCE_STRINGID(ToolDescription);
         WINGET_DEFINE_RESOURCE_STRINGID(ToolInfoArgumentDescription);
         WINGET_DEFINE_RESOURCE_STRINGID(ToolVersionArgumentDescription);
@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "Public/ShutdownMonitoring.h"
 #include <AppInstallerErrors.h>
+#include <AppInstallerFileLogger.h>
 #include <AppInstallerLogging.h>
 #include <AppInstallerRuntime.h>
 #include <winget/COMStaticStorage.h>
@@ -167,7 +168,12 @@ namespace AppInstaller::ShutdownMonitoring
         case CTRL_CLOSE_EVENT:
         case CTRL_LOGOFF_EVENT:
         case CTRL_SHUTDOWN_EVENT:
-            return InformListeners(CancelReason::CtrlCSignal, true);
+        {
+            BOOL result = InformListeners(CancelReason::CtrlCSignal, true);
+            // The process is terminated when this returns, so get the logs to disk.
+            Logging::FileLogger::FlushAll();
+            return result;
+        }
         default:
             return FALSE;
         }
@@ -395,6 +401,8 @@ namespace AppInstaller::ShutdownMonitoring
         }
 
         AICLI_LOG(CLI, Verbose, << "ServerShutdownSynchronization :: ShutdownCompleteCallback");
+        Logging::FileLogger::FlushAll();
+
         ShutdownCompleteCallback callback = m_callback;
         if (callback)
         {
@@ -10,6 +10,7 @@
 #include <AppInstallerMsixInfo.h>
 #include <winget/AdminSettings.h>
 #include <winget/GroupPolicy.h>
+#include <winget/InstallerCache.h>
 #include <winget/ManifestYamlWriter.h>
 #include <winget/NetworkSettings.h>
 
@@ -195,8 +196,7 @@ namespace AppInstaller::CLI::Workflow
             if (std::filesystem::exists(filePath))
             {
                 AICLI_LOG(CLI, Info, << "Found existing installer file at '" << filePath << "'. Verifying file hash.");
-                std::ifstream inStream{ filePath, std::ifstream::binary };
-                fileHashDetails = SHA256::ComputeHashDetails(inStream);
+                fileHashDetails = SHA256::ComputeHashDetailsFromFile(filePath);
 
                 if (SHA256::AreEqual(expectedHash, fileHashDetails.Hash))
                 {
@@ -269,6 +269,89 @@ namespace AppInstaller::CLI::Workflow
 
             return result;
         }
+
+        // Adds the installer to the installer cache if it is enabled and the installer hash was verified.
+        void AddInstallerToCacheIfApplicable(Execution::Context& context)
+        {
+            if (WI_IsFlagClear(context.GetFlags(), Execution::ContextFlag::InstallerHashMatched) ||
+                !context.Contains(Execution::Data::InstallerPath))
+            {
+                return;
+            }
+
+            auto cache = Caching::InstallerCache::CreateFromUserSettings();
+            if (cache)
+            {
+                cache->Add(context.Get<Execution::Data::Installer>()->Sha256, context.Get<Execution::Data::InstallerPath>());
+            }
+        }
+
+        // Opens the installer file for reading while preventing anyone from writing to it.
+        wil::unique_hfile OpenInstallerFileDenyWrite(const std::filesystem::path& installerPath, DWORD flags = FILE_ATTRIBUTE_NORMAL, DWORD shareMode = FILE_SHARE_READ)
+        {
+            return wil::unique_hfile{ CreateFileW(installerPath.c_str(), GENERIC_READ, shareMode, nullptr, OPEN_EXISTING, flags, nullptr) };
+        }
+
+        // Opens the downloaded installer file if it is still the one whose identity was captured by the download, while the hash was computed.
+        // The handle prevents writes until the identity is recorded; deletes are shared so that the file can still be renamed.
+        // Returns an empty handle if there is no such identity, as for an existing or cached installer, or if the file has changed since.
+        wil::unique_hfile OpenDownloadedInstallerFile(Execution::Context& context) try
+        {
+            if (!context.Contains(Execution::Data::InstallerPath) ||
+                !context.Contains(Execution::Data::DownloadHashInfo) ||
+                !context.Get<Execution::Data::DownloadHashInfo>().second.FileIdentity)
+            {
+                return {};
+            }
+
+            wil::unique_hfile installerFile = OpenInstallerFileDenyWrite(context.Get<Execution::Data::InstallerPath>(), FILE_ATTRIBUTE_NORMAL, FILE_SHARE_READ | FILE_SHARE_DELETE);
+            if (!installerFile)
+            {
+                // Someone is writing to the file; it will be hashed again when reverified.
+                AICLI_LOG(CLI, Info, << "Unable to open downloaded installer file: " << GetLastError());
+                return {};
+            }
+
+            if (Filesystem::GetFileIdentity(installerFile.get()) != context.Get<Execution::Data::DownloadHashInfo>().second.FileIdentity.value())
+            {
+                AICLI_LOG(CLI, Info, << "Downloaded installer file changed after it was hashed");
+                return {};
+            }
+
+            return installerFile;
+        }
+        catch (...)
+        {
+            LOG_CAUGHT_EXCEPTION_MSG("OpenDownloadedInstallerFile exception");
+            return {};
+        }
+
+        // Records the identity of the installer file whose hash was verified, so that it need not be hashed again
+        // by ReverifyInstallerHash if it has not changed since.
+        // The identity is taken from the handle opened by OpenDownloadedInstallerFile, which has denied writes since the download hashed the file.
+        void RecordInstallerFileIdentity(Execution::Context& context, HANDLE installerFile) try
+        {
+            if (!installerFile || WI_IsFlagClear(context.GetFlags(), Execution::ContextFlag::InstallerHashMatched))
+            {
+                return;
+            }
+
+            context.Add<Execution::Data::InstallerFileIdentity>(Filesystem::GetFileIdentity(installerFile));
+        }
+        CATCH_LOG_MSG("RecordInstallerFileIdentity exception");
+
+        // Determines if the installer file is the same one whose hash was verified.
+        bool IsInstallerFileUnchanged(Execution::Context& context, HANDLE installerFile) try
+        {
+            return context.Contains(Execution::Data::InstallerFileIdentity) &&
+                context.Contains(Execution::Data::DownloadHashInfo) &&
+                Filesystem::GetFileIdentity(installerFile) == context.Get<Execution::Data::InstallerFileIdentity>();
+        }
+        catch (...)
+        {
+            LOG_CAUGHT_EXCEPTION_MSG("IsInstallerFileUnchanged exception");
+            return false;
+        }
     }
 
     void DownloadInstaller(Execution::Context& context)
@@ -336,11 +419,31 @@ namespace AppInstaller::CLI::Workflow
             }
         }
 
+        // Held from here until the identity is recorded, so that the file cannot be swapped after it was hashed.
+        // It must be closed before the installer runs.
+        wil::unique_hfile installerFile = OpenDownloadedInstallerFile(context);
+
+        context << VerifyInstallerHash;
+
+        if (context.IsTerminated())
+        {
+            return;
+        }
+
+        AddInstallerToCacheIfApplicable(context);
+
         context <<
-            VerifyInstallerHash <<
             RenameDownloadedInstaller <<
             UpdateInstallerFileMotwIfApplicable;
 
+        if (context.IsTerminated())
+        {
+            return;
+        }
+
+        RecordInstallerFileIdentity(context, installerFile.get());
+        installerFile.reset();
+
         if (installerDownloadOnly)
         {
             context << ExportManifest;
@@ -365,8 +468,25 @@ namespace AppInstaller::CLI::Workflow
             installerFilename = GetInstallerPostHashValidationFileName(context);
             if (!ExistingInstallerFileHasHashMatch(installer.Sha256, installerPath / installerFilename, fileHashDetails))
             {
-                // No match
-                return;
+                // No local match; the installer may have been downloaded before by another package, user or machine.
+                auto cache = Caching::InstallerCache::CreateFromUserSettings();
+                if (!cache)
+                {
+                    return;
+                }
+
+                installerFilename = GetInstallerPreHashValidationFileName(context);
+                auto cachedHashDetails = cache->TryGet(installer.Sha256, installerPath / installerFilename);
+                if (!cachedHashDetails)
+                {
+                    return;
+                }
+
+                AICLI_LOG(CLI, Info, << "Installer found in the installer cache. Will use cached installer.");
+
+                // Treat the copy the same as a new download, as the cache may be shared.
+                Utility::ApplyMotwIfApplicable(installerPath / installerFilename, URLZONE_INTERNET);
+                fileHashDetails = std::move(cachedHashDetails).value();
             }
         }
 
@@ -642,12 +762,22 @@ namespace AppInstaller::CLI::Workflow
 
         if (context.Contains(Execution::Data::InstallerPath))
         {
-            // Get the hash from the installer file
+            // Keep writers out while the file is checked.
             const auto& installerPath = context.Get<Execution::Data::InstallerPath>();
-            std::ifstream inStream{ installerPath, std::ifstream::binary };
-            auto existingFileHashDetails = SHA256::ComputeHashDetails(inStream);
-            context.Add<Execution::Data::DownloadHashInfo>(std::make_pair(installer.Sha256,
-                DownloadResult{ existingFileHashDetails.Hash, existingFileHashDetails.SizeInBytes }));
+            wil::unique_hfile installerFile = OpenInstallerFileDenyWrite(installerPath, FILE_FLAG_OVERLAPPED | FILE_FLAG_SEQUENTIAL_SCAN);
+            THROW_LAST_ERROR_IF(!installerFile);
+
+            if (IsInstallerFileUnchanged(context, installerFile.get()))
+            {
+                AICLI_LOG(CLI, Info, << "Installer file is unchanged since its hash was verified");
+            }
+            else
+            {
+                // Get the hash from the installer file
+                auto existingFileHashDetails = SHA256::ComputeHashDetailsFromOverlappedHandle(installerFile.get());
+                context.Add<Execution::Data::DownloadHashInfo>(std::make_pair(installer.Sha256,
+                    DownloadResult{ existingFileHashDetails.Hash, existingFileHashDetails.SizeInBytes }));
+            }
         }
         else if (installer.EffectiveInstallerType() == InstallerTypeEnum::MSStore)
         {
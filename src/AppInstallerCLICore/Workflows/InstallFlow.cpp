@@ -27,6 +27,7 @@
 #include <winget/Archive.h>
 #include <winget/PathVariable.h>
 #include <winget/Runtime.h>
+#include <winget/Timing.h>
 
 using namespace winrt::Windows::Foundation;
 using namespace winrt::Windows::Foundation::Collections;
@@ -417,6 +418,8 @@ namespace AppInstaller::CLI::Workflow
             }
         }
 
+        Timing::ScopedTimer timer{ Timing::Phase::Install };
+
         switch (m_installerType)
         {
         case InstallerTypeEnum::Exe:
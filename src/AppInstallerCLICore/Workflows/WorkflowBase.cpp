@@ -1770,14 +1770,14 @@ namespace AppInstaller::CLI::Workflow
         searchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::Id, MatchType::CaseInsensitive, manifest.Id));
         
         // In case there are same Ids from different sources, filter the result using package name
-        for (const auto& localization : manifest.Localizations)
-        {
-            const auto& localizedPackageName = localization.Get<Manifest::Localization::PackageName>();
-            if (!localizedPackageName.empty())
+        manifest.ForEachLocalization([&](const Manifest::ManifestLocalization& localization)
             {
-                searchRequest.Filters.emplace_back(PackageMatchField::Name, MatchType::CaseInsensitive, localizedPackageName);
-            }
-        }
+                const auto& localizedPackageName = localization.Get<Manifest::Localization::PackageName>();
+                if (!localizedPackageName.empty())
+                {
+                    searchRequest.Filters.emplace_back(PackageMatchField::Name, MatchType::CaseInsensitive, localizedPackageName);
+                }
+            });
 
         searchRequest.Filters.emplace_back(PackageMatchFilter(PackageMatchField::Name, MatchType::CaseInsensitive, manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>()));
 
@@ -1879,6 +1879,13 @@ TEST_CASE("CompositeSource_SxS_TwoVersions_SameAvailable", "[CompositeSource][Si
     REQUIRE(installedVersions.size() == 2);
     REQUIRE(std::any_of(installedVersions.begin(), installedVersions.end(), [&](const PackageVersionKey& key) { return key.Version == version1; }));
     REQUIRE(std::any_of(installedVersions.begin(), installedVersions.end(), [&](const PackageVersionKey& key) { return key.Version == version2; }));
+    for (const auto& key : installedVersions)
+    {
+        REQUIRE(key.InstalledPackageId);
+        auto installedVersion = installedPackage->GetVersion(key);
+        REQUIRE(installedVersion);
+        REQUIRE(installedVersion->GetProperty(PackageVersionProperty::Version) == key.Version);
+    }
     auto availablePackages = package->GetAvailable();
     REQUIRE(availablePackages.size() == 1);
     REQUIRE(availablePackages[0]->IsSame(availablePackage->Available[0].get()));
@@ -4,6 +4,7 @@
 #include "TestCommon.h"
 #include "AppInstallerDownloader.h"
 #include "AppInstallerSHA256.h"
+#include "DownloadSegmentMap.h"
 #include "HttpStream/HttpLocalCache.h"
 
 using namespace AppInstaller;
@@ -169,3 +170,40 @@ TEST_CASE("CacheControl", "[Downloader]")
         REQUIRE(test.MaxAge == 0);
     }
 }
+
+TEST_CASE("DownloadSegmentMap_SaveAndLoad", "[Downloader]")
+{
+    TestCommon::TempFile tempFile("segment_map_test"s, ".segments"s);
+
+    DownloadSegmentMap map{ "\"etag\"", 25, 10 };
+    REQUIRE(map.Segments.size() == 3);
+    REQUIRE(map.Segments[2].Offset == 20);
+    REQUIRE(map.Segments[2].Size == 5);
+    REQUIRE(!map.IsComplete());
+
+    map.Segments[0].Completed = 10;
+    map.Segments[1].Completed = 4;
+    map.Save(tempFile.GetPath());
+
+    SECTION("Same content")
+    {
+        auto loaded = DownloadSegmentMap::Load(tempFile.GetPath(), "\"etag\"", 25);
+        REQUIRE(loaded);
+        REQUIRE(loaded->Segments.size() == 3);
+        REQUIRE(loaded->Segments[0].IsComplete());
+        REQUIRE(loaded->Segments[1].Completed == 4);
+        REQUIRE(loaded->CompletedSize() == 14);
+    }
+    SECTION("Different validator")
+    {
+        REQUIRE(!DownloadSegmentMap::Load(tempFile.GetPath(), "\"other\"", 25));
+    }
+    SECTION("Different size")
+    {
+        REQUIRE(!DownloadSegmentMap::Load(tempFile.GetPath(), "\"etag\"", 26));
+    }
+    SECTION("No validator")
+    {
+        REQUIRE(!DownloadSegmentMap::Load(tempFile.GetPath(), "", 25));
+    }
+}
@@ -154,6 +154,23 @@ TEST_CASE("FileCache_CachedFileGoodHash", "[file_cache]")
     testFileCache.RequireCachedFile(sourceFile);
 }
 
+TEST_CASE("FileCache_GetFileContents", "[file_cache]")
+{
+    TestFileCache testFileCache;
+    INFO("Cache location: " << testFileCache->GetDetails().GetCachePath().u8string());
+
+    auto sourceFile = testFileCache.PrepareUpstreamFile("InstallFlowTest_MSStore.yaml");
+
+    // The first read comes from upstream, the second from the cache
+    for (size_t i = 0; i < 2; ++i)
+    {
+        INFO(i);
+        std::string contents = testFileCache->GetFileContents(sourceFile.Offset, sourceFile.ContentHash);
+        REQUIRE(SHA256::AreEqual(sourceFile.ContentHash, SHA256::ComputeHash(contents)));
+        testFileCache.RequireCachedFile(sourceFile);
+    }
+}
+
 TEST_CASE("FileCache_CachedFileBadHash", "[file_cache]")
 {
     TestFileCache testFileCache;
@@ -238,3 +255,36 @@ TEST_CASE("FileCache_PathTooLong", "[file_cache]")
     REQUIRE(cachedStream);
     REQUIRE(SHA256::AreEqual(sourceFile.ContentHash, SHA256::ComputeHash(ReadEntireStreamAsByteArray(*cachedStream))));
 }
+
+TEST_CASE("FileCache_DerivedContents", "[file_cache]")
+{
+    TestFileCache testFileCache;
+    INFO("Cache location: " << testFileCache->GetDetails().GetCachePath().u8string());
+
+    auto sourceFile = testFileCache.PrepareUpstreamFile("Manifest-Good-MultiLocale.yaml");
+    std::string_view derivedName = "derived";
+    std::string_view derivedContents = "derived contents";
+
+    REQUIRE_FALSE(testFileCache->GetDerivedContents(sourceFile.Offset, sourceFile.ContentHash, derivedName).has_value());
+
+    testFileCache->StoreDerivedContents(sourceFile.Offset, sourceFile.ContentHash, derivedName, derivedContents);
+
+    auto derived = testFileCache->GetDerivedContents(sourceFile.Offset, sourceFile.ContentHash, derivedName);
+    REQUIRE(derived.has_value());
+    REQUIRE(derived.value() == derivedContents);
+
+    // Another cache for the same location sees the stored contents
+    FileCache otherCache{ FileCache::Type::Tests, testFileCache->GetDetails().Identifier, {} };
+    auto otherDerived = otherCache.GetDerivedContents(sourceFile.Offset, sourceFile.ContentHash, derivedName);
+    REQUIRE(otherDerived.has_value());
+    REQUIRE(otherDerived.value() == derivedContents);
+
+    // Nothing is written beside the cached file
+    std::filesystem::path derivedFilePath = testFileCache->GetDetails().GetCachePath() / sourceFile.Offset;
+    derivedFilePath += ".derived";
+    REQUIRE_FALSE(std::filesystem::exists(derivedFilePath));
+
+    // Contents derived from a different source hash are not returned, and are removed as stale
+    REQUIRE_FALSE(testFileCache->GetDerivedContents(sourceFile.Offset, SHA256::ComputeHash("garbage"), derivedName).has_value());
+    REQUIRE_FALSE(testFileCache->GetDerivedContents(sourceFile.Offset, sourceFile.ContentHash, derivedName).has_value());
+}
@@ -4,6 +4,7 @@
 #include "TestCommon.h"
 #include <AppInstallerFileLogger.h>
 #include <AppInstallerStrings.h>
+#include <regex>
 
 using namespace AppInstaller::Logging;
 using namespace AppInstaller::Utility;
@@ -243,3 +244,124 @@ TEST_CASE("FileLogger_MaximumSize_ManyWraps", "[logging]")
 
     ValidateFileContents(tempFile, expectedFileContents, maximumSize);
 }
+
+TEST_CASE("FileLogger_BackgroundWriter", "[logging]")
+{
+    TempFile tempFile{ "FileLogger_BackgroundWriter", ".log" };
+
+    constexpr size_t threadCount = 4;
+    // More than fit in the queue, so that the logging threads must also make room
+    constexpr size_t linesPerThread = 5000;
+
+    {
+        FileLogger logger{ tempFile };
+        logger.SetMaximumSize(0);
+        logger.EnableBackgroundWriter();
+
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back([&logger, i]()
+                {
+                    for (size_t j = 0; j < linesPerThread; ++j)
+                    {
+                        logger.Write(DefaultChannel, DefaultLevel, "Thread " + std::to_string(i) + " line " + std::to_string(j) + '&');
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        // A direct write must come after everything that was logged before it
+        logger.WriteDirect(DefaultChannel, DefaultLevel, "Direct line");
+    }
+
+    std::ifstream fileStream{ tempFile.GetPath() };
+    std::vector<size_t> nextLine(threadCount);
+    std::string line;
+    size_t lineCount = 0;
+    bool directLineSeen = false;
+
+    while (std::getline(fileStream, line))
+    {
+        ++lineCount;
+
+        if (line == "Direct line")
+        {
+            REQUIRE_FALSE(directLineSeen);
+            directLineSeen = true;
+            continue;
+        }
+
+        REQUIRE_FALSE(directLineSeen);
+
+        auto threadPosition = line.find("Thread ");
+        REQUIRE(threadPosition != std::string::npos);
+        REQUIRE(line.back() == '&');
+
+        size_t threadIndex = std::stoul(line.substr(threadPosition + 7));
+        size_t lineIndex = std::stoul(line.substr(line.find(" line ") + 6));
+
+        // Lines from a single thread stay in order
+        REQUIRE(threadIndex < threadCount);
+        REQUIRE(lineIndex == nextLine[threadIndex]);
+        ++nextLine[threadIndex];
+    }
+
+    REQUIRE(directLineSeen);
+    REQUIRE(lineCount == threadCount * linesPerThread + 1);
+}
+
+TEST_CASE("FileLogger_LineFormat", "[logging]")
+{
+    TempFile tempFile{ "FileLogger_LineFormat", ".log" };
+
+    {
+        FileLogger logger{ tempFile };
+        logger.Write(DefaultChannel, DefaultLevel, "Formatted message");
+        logger.Write(AppInstaller::Logging::Channel::CLI, AppInstaller::Logging::Level::Verbose, "Short channel");
+    }
+
+    std::ifstream fileStream{ tempFile.GetPath() };
+    std::string line;
+
+    REQUIRE(std::getline(fileStream, line));
+    REQUIRE(std::regex_match(line, std::regex{ R"(\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}\.\d{3} <I> \[CORE\] Formatted message)" }));
+
+    REQUIRE(std::getline(fileStream, line));
+    REQUIRE(std::regex_match(line, std::regex{ R"(\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}\.\d{3} <V> \[CLI \] Short channel)" }));
+}
+
+TEST_CASE("LoggingStream_ReusedBuffer", "[logging]")
+{
+    {
+        LoggingStream stream;
+        stream << std::hex << 255 << std::setw(8) << std::setfill('0');
+        REQUIRE(stream.view() == "ff");
+    }
+
+    // Formatting from the previous message does not carry over
+    {
+        LoggingStream stream;
+        stream << 255 << '|' << 1;
+        REQUIRE(stream.view() == "255|1");
+    }
+
+    // A message formatted while another is in progress does not disturb it
+    {
+        LoggingStream outer;
+        outer << "outer ";
+
+        {
+            LoggingStream inner;
+            inner << "inner";
+            REQUIRE(inner.view() == "inner");
+        }
+
+        outer << "done";
+        REQUIRE(outer.view() == "outer done");
+    }
+}
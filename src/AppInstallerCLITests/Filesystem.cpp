@@ -5,6 +5,7 @@
 #include <winget/Filesystem.h>
 #include <winget/PathTree.h>
 #include <AppInstallerStrings.h>
+#include <AppInstallerSHA256.h>
 
 using namespace AppInstaller::Utility;
 using namespace AppInstaller::Filesystem;
@@ -492,3 +493,115 @@ TEST_CASE("FilterToFilesExceedingLimits", "[filesystem]")
         RequireFilePaths(files, { "h", "g", "f", "e", "d", "c" });
     }
 }
+
+TEST_CASE("GetFileIdentity", "[filesystem]")
+{
+    TestCommon::TempDirectory tempDirectory{ "GetFileIdentity" };
+    auto tempFile = tempDirectory.CreateTempFile("identity", ".txt");
+
+    {
+        std::ofstream stream{ tempFile.GetPath(), std::ios_base::out | std::ios_base::binary };
+        stream << "Original content";
+    }
+
+    auto getIdentity = [&]()
+    {
+        wil::unique_hfile fileHandle{ CreateFileW(tempFile.GetPath().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+        REQUIRE(fileHandle);
+        return GetFileIdentity(fileHandle.get());
+    };
+
+    FileIdentity original = getIdentity();
+    REQUIRE(original.Size == 16);
+    REQUIRE(original == getIdentity());
+
+    SECTION("Content changed")
+    {
+        std::this_thread::sleep_for(100ms);
+        std::ofstream stream{ tempFile.GetPath(), std::ios_base::out | std::ios_base::binary };
+        stream << "Replaced content";
+        stream.close();
+
+        REQUIRE(original != getIdentity());
+    }
+    SECTION("File replaced")
+    {
+        auto otherFile = tempDirectory.CreateTempFile("other", ".txt");
+        {
+            std::ofstream stream{ otherFile.GetPath(), std::ios_base::out | std::ios_base::binary };
+            stream << "Original content";
+        }
+
+        std::filesystem::last_write_time(otherFile.GetPath(), std::filesystem::last_write_time(tempFile.GetPath()));
+        std::filesystem::rename(otherFile.GetPath(), tempFile.GetPath());
+
+        REQUIRE(original != getIdentity());
+    }
+}
+
+TEST_CASE("ComputeHashDetailsFromOverlappedHandle", "[filesystem]")
+{
+    TestCommon::TempDirectory tempDirectory{ "ComputeHashDetailsFromOverlappedHandle" };
+    auto tempFile = tempDirectory.CreateTempFile("hash", ".bin");
+
+    size_t size = GENERATE(0, 1, 4 * 1024 * 1024, 9 * 1024 * 1024 + 7);
+
+    std::string content(size, '\0');
+    for (size_t i = 0; i < content.size(); ++i)
+    {
+        content[i] = static_cast<char>(i * 31);
+    }
+
+    {
+        std::ofstream stream{ tempFile.GetPath(), std::ios_base::out | std::ios_base::binary };
+        stream << content;
+    }
+
+    wil::unique_hfile fileHandle{ CreateFileW(tempFile.GetPath().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_OVERLAPPED, nullptr) };
+    REQUIRE(fileHandle);
+
+    SHA256::HashDetails details = SHA256::ComputeHashDetailsFromOverlappedHandle(fileHandle.get());
+    REQUIRE(details.SizeInBytes == size);
+    REQUIRE(SHA256::AreEqual(details.Hash, SHA256::ComputeHash(content)));
+}
+
+TEST_CASE("ComputeHashDetailsFromFiles", "[filesystem]")
+{
+    TestCommon::TempDirectory tempDirectory{ "ComputeHashDetailsFromFiles" };
+
+    std::vector<std::filesystem::path> paths;
+    std::vector<std::string> contents;
+
+    for (size_t i = 0; i < 8; ++i)
+    {
+        std::string content(i * 1024 * 1024 + i, '\0');
+        for (size_t j = 0; j < content.size(); ++j)
+        {
+            content[j] = static_cast<char>(j * 31 + i);
+        }
+
+        std::filesystem::path path = tempDirectory.GetPath() / ("hash" + std::to_string(i) + ".bin");
+        {
+            std::ofstream stream{ path, std::ios_base::out | std::ios_base::binary };
+            stream << content;
+        }
+
+        paths.emplace_back(std::move(path));
+        contents.emplace_back(std::move(content));
+    }
+
+    size_t maxConcurrency = GENERATE(0, 1, 3, 16);
+
+    std::vector<SHA256::HashDetails> results = SHA256::ComputeHashDetailsFromFiles(paths, maxConcurrency);
+    REQUIRE(results.size() == paths.size());
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        REQUIRE(results[i].SizeInBytes == contents[i].size());
+        REQUIRE(SHA256::AreEqual(results[i].Hash, SHA256::ComputeHash(contents[i])));
+    }
+
+    // A file that cannot be read fails the whole operation
+    paths.emplace_back(tempDirectory.GetPath() / "missing.bin");
+    REQUIRE_THROWS(SHA256::ComputeHashDetailsFromFiles(paths, maxConcurrency));
+}
@@ -22,6 +22,47 @@ TEST_CASE("ExtractJsonResponse_UnsupportedMimeType", "[RestSource][RestSearch]")
     REQUIRE_THROWS_HR(helper.HandleGet(L"https://testUri"), APPINSTALLER_CLI_ERROR_RESTAPI_UNSUPPORTED_MIME_TYPE);
 }
 
+TEST_CASE("ExtractJsonResponse_Utf8Body", "[RestSource]")
+{
+    std::string body = u8"{ \"Name\": \"\u00c9l\u00e8ve \u6f22\u5b57\", \"Values\": [ 1, 2 ] }";
+
+    HttpClientHelper helper{ std::make_shared<TestRestRequestHandler>([body](web::http::http_request) -> pplx::task<web::http::http_response>
+        {
+            web::http::http_response response;
+            response.set_body(body, "application/json; charset=utf-8");
+            response.set_status_code(web::http::status_codes::OK);
+            return pplx::task_from_result(response);
+        }) };
+
+    auto result = helper.HandleGet(L"https://testUri");
+    REQUIRE(result.has_value());
+    REQUIRE(result->at(L"Name").as_string() == L"\u00c9l\u00e8ve \u6f22\u5b57");
+    REQUIRE(result->at(L"Values").as_array().size() == 2);
+}
+
+TEST_CASE("HandleGetForBody_Utf8Body", "[RestSource]")
+{
+    std::string body = u8"{ \"Name\": \"\u00c9l\u00e8ve \u6f22\u5b57\" }";
+
+    HttpClientHelper helper{ std::make_shared<TestRestRequestHandler>([body](web::http::http_request) -> pplx::task<web::http::http_response>
+        {
+            web::http::http_response response;
+            response.set_body(body, "application/json; charset=utf-8");
+            response.set_status_code(web::http::status_codes::OK);
+            return pplx::task_from_result(response);
+        }) };
+
+    auto result = helper.HandleGetForBody(L"https://testUri");
+    REQUIRE(result.has_value());
+    REQUIRE(result.value() == body);
+}
+
+TEST_CASE("HandleGetForBody_NoContent", "[RestSource]")
+{
+    HttpClientHelper helper{ GetTestRestRequestHandler(web::http::status_codes::NoContent) };
+    REQUIRE_FALSE(helper.HandleGetForBody(L"https://testUri").has_value());
+}
+
 TEST_CASE("ValidateAndExtractResponse_ServiceUnavailable", "[RestSource]")
 {
     HttpClientHelper helper{ GetTestRestRequestHandler(web::http::status_codes::ServiceUnavailable) };
@@ -90,3 +131,27 @@ TEST_CASE("HttpClientHelper_CallerCharacters", "[RestSource]")
     HttpClientHelper helper;
     REQUIRE_THROWS_HR(helper.HandleGet(L"https://github.com", headers), APPINSTALLER_CLI_ERROR_RESTAPI_UNSUPPORTED_MIME_TYPE);
 }
+
+TEST_CASE("HttpClientHelper_PooledClientRequestUri", "[RestSource]")
+{
+    HttpClientHelper helper{ GetTestRestRequestHandler([](const web::http::http_request& request)
+        {
+            web::uri requestUri = request.absolute_uri();
+            if (requestUri.path() == L"/packages/search" && requestUri.query() == L"version=1.0")
+            {
+                return web::http::status_codes::OK;
+            }
+            else
+            {
+                return web::http::status_codes::BadRequest;
+            }
+        }) };
+
+    // Requests to the same host share a pooled client; each must still reach its own resource.
+    REQUIRE_NOTHROW(helper.HandleGet(L"https://testUri/packages/search?version=1.0"));
+    REQUIRE_NOTHROW(helper.HandlePost(L"https://testUri/packages/search?version=1.0", {}));
+
+    HttpClientHelper copy = helper;
+    REQUIRE_NOTHROW(copy.HandleGet(L"https://testUri/packages/search?version=1.0"));
+    REQUIRE_THROWS_HR(copy.HandleGet(L"https://testUri/other"), APPINSTALLER_CLI_ERROR_RESTAPI_INTERNAL_ERROR);
+}
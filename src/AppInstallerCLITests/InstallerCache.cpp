@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TestCommon.h"
+#include <winget/InstallerCache.h>
+
+using namespace AppInstaller::Caching;
+using namespace AppInstaller::Utility;
+using namespace TestCommon;
+using namespace std::string_view_literals;
+
+namespace
+{
+    SHA256::HashBuffer WriteInstallerFile(const std::filesystem::path& path, std::string_view contents)
+    {
+        {
+            std::ofstream stream{ path, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary };
+            stream << contents;
+        }
+
+        return SHA256::ComputeHash(contents);
+    }
+
+    std::filesystem::path GetEntryPath(const InstallerCache& cache, const SHA256::HashBuffer& hash)
+    {
+        return cache.GetDirectory() / SHA256::ConvertToString(hash);
+    }
+}
+
+TEST_CASE("InstallerCache_NotFound", "[installer_cache]")
+{
+    TempDirectory cacheDirectory{ "InstallerCache" };
+    TempDirectory workDirectory{ "InstallerCacheWork" };
+    InstallerCache cache{ cacheDirectory.GetPath(), 1024 };
+
+    std::filesystem::path target = workDirectory.GetPath() / "target.exe";
+    SHA256::HashBuffer hash = SHA256::ComputeHash("not in the cache"sv);
+
+    REQUIRE_FALSE(cache.TryGet(hash, target));
+    REQUIRE_FALSE(std::filesystem::exists(target));
+}
+
+TEST_CASE("InstallerCache_AddAndGet", "[installer_cache]")
+{
+    TempDirectory cacheDirectory{ "InstallerCache" };
+    TempDirectory workDirectory{ "InstallerCacheWork" };
+    InstallerCache cache{ cacheDirectory.GetPath(), 1024 };
+
+    std::string_view contents = "installer contents";
+    std::filesystem::path source = workDirectory.GetPath() / "source.exe";
+    SHA256::HashBuffer hash = WriteInstallerFile(source, contents);
+
+    cache.Add(hash, source);
+    REQUIRE(std::filesystem::exists(GetEntryPath(cache, hash)));
+
+    std::filesystem::path target = workDirectory.GetPath() / "target.exe";
+    auto result = cache.TryGet(hash, target);
+
+    REQUIRE(result);
+    REQUIRE(SHA256::AreEqual(hash, result->Hash));
+    REQUIRE(result->SizeInBytes == contents.size());
+    REQUIRE(std::filesystem::file_size(target) == contents.size());
+}
+
+TEST_CASE("InstallerCache_HashMismatch", "[installer_cache]")
+{
+    TempDirectory cacheDirectory{ "InstallerCache" };
+    TempDirectory workDirectory{ "InstallerCacheWork" };
+    InstallerCache cache{ cacheDirectory.GetPath(), 1024 };
+
+    std::filesystem::path source = workDirectory.GetPath() / "source.exe";
+    SHA256::HashBuffer hash = WriteInstallerFile(source, "installer contents");
+    cache.Add(hash, source);
+
+    // Tamper with the entry, as could be done in a shared directory
+    WriteInstallerFile(GetEntryPath(cache, hash), "tampered contents");
+
+    std::filesystem::path target = workDirectory.GetPath() / "target.exe";
+    REQUIRE_FALSE(cache.TryGet(hash, target));
+    REQUIRE_FALSE(std::filesystem::exists(target));
+    REQUIRE_FALSE(std::filesystem::exists(GetEntryPath(cache, hash)));
+}
+
+TEST_CASE("InstallerCache_TooLarge", "[installer_cache]")
+{
+    TempDirectory cacheDirectory{ "InstallerCache" };
+    TempDirectory workDirectory{ "InstallerCacheWork" };
+    InstallerCache cache{ cacheDirectory.GetPath(), 4 };
+
+    std::filesystem::path source = workDirectory.GetPath() / "source.exe";
+    SHA256::HashBuffer hash = WriteInstallerFile(source, "larger than the cache");
+    cache.Add(hash, source);
+
+    REQUIRE_FALSE(std::filesystem::exists(GetEntryPath(cache, hash)));
+}
+
+TEST_CASE("InstallerCache_EvictLeastRecentlyUsed", "[installer_cache]")
+{
+    TempDirectory cacheDirectory{ "InstallerCache" };
+    TempDirectory workDirectory{ "InstallerCacheWork" };
+
+    // Room for two of the installers but not three
+    InstallerCache cache{ cacheDirectory.GetPath(), 20 };
+
+    std::filesystem::path first = workDirectory.GetPath() / "first.exe";
+    SHA256::HashBuffer firstHash = WriteInstallerFile(first, "first----");
+    cache.Add(firstHash, first);
+
+    std::filesystem::path second = workDirectory.GetPath() / "second.exe";
+    SHA256::HashBuffer secondHash = WriteInstallerFile(second, "second---");
+    cache.Add(secondHash, second);
+
+    // Make the first installer the most recently used
+    auto now = std::filesystem::file_time_type::clock::now();
+    std::filesystem::last_write_time(GetEntryPath(cache, firstHash), now);
+    std::filesystem::last_write_time(GetEntryPath(cache, secondHash), now - std::chrono::hours{ 1 });
+
+    std::filesystem::path third = workDirectory.GetPath() / "third.exe";
+    SHA256::HashBuffer thirdHash = WriteInstallerFile(third, "third----");
+    cache.Add(thirdHash, third);
+
+    REQUIRE(std::filesystem::exists(GetEntryPath(cache, firstHash)));
+    REQUIRE_FALSE(std::filesystem::exists(GetEntryPath(cache, secondHash)));
+    REQUIRE(std::filesystem::exists(GetEntryPath(cache, thirdHash)));
+}
@@ -101,3 +101,50 @@ TEST_CASE("PackageVersionDataManifest_CompressionRoundTrip", "[PackageVersionDat
         RequireVersionDataEqual(copy.Versions()[i], original.Versions()[i]);
     }
 }
+
+TEST_CASE("PackageVersionDataManifest_DeserializeCompressed", "[PackageVersionDataManifest]")
+{
+    PackageVersionDataManifest original;
+    original.AddVersion({ VersionAndChannel{ Version{ "1.0" }, Channel{} }, ".99", "1.01", "path", "hash" });
+    original.AddVersion({ VersionAndChannel{ Version{ "2.0" }, Channel{} }, "3.99", "15.01", "path4", "hash4" });
+
+    PackageVersionDataManifest larger;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        larger.AddVersion({ VersionAndChannel{ Version{ std::to_string(i) }, Channel{} }, {}, {}, "path" + std::to_string(i), "hash" + std::to_string(i) });
+    }
+
+    // The decompression buffer is reused, so alternate between sizes and formats
+    for (auto format : { PackageVersionDataManifest::CompressionFormat::MSZip, PackageVersionDataManifest::CompressionFormat::Zlib, PackageVersionDataManifest::CompressionFormat::MSZip })
+    {
+        INFO(static_cast<int>(format));
+
+        for (PackageVersionDataManifest* manifest : { &original, &larger, &original })
+        {
+            std::vector<uint8_t> compressed = PackageVersionDataManifest::Compress(manifest->Serialize(), format);
+
+            PackageVersionDataManifest copy;
+            copy.DeserializeCompressed({ reinterpret_cast<const char*>(compressed.data()), compressed.size() });
+
+            REQUIRE(manifest->Versions().size() == copy.Versions().size());
+
+            for (size_t i = 0; i < manifest->Versions().size(); ++i)
+            {
+                INFO(i);
+                RequireVersionDataEqual(copy.Versions()[i], manifest->Versions()[i]);
+            }
+        }
+    }
+}
+
+TEST_CASE("PackageVersionDataManifest_DeserializeCompressed_ZlibTruncated", "[PackageVersionDataManifest]")
+{
+    PackageVersionDataManifest original;
+    original.AddVersion({ VersionAndChannel{ Version{ "1.0" }, Channel{} }, ".99", "1.01", "path", "hash" });
+
+    std::vector<uint8_t> compressed = PackageVersionDataManifest::Compress(original.Serialize(), PackageVersionDataManifest::CompressionFormat::Zlib);
+    compressed.resize(compressed.size() / 2);
+
+    PackageVersionDataManifest copy;
+    REQUIRE_THROWS_HR(copy.DeserializeCompressed({ reinterpret_cast<const char*>(compressed.data()), compressed.size() }), HRESULT_FROM_WIN32(ERROR_INVALID_DATA));
+}
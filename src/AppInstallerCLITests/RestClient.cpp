@@ -5,6 +5,7 @@
 #include "TestRestRequestHandler.h"
 #include <Rest/RestClient.h>
 #include <Rest/RestInformationCache.h>
+#include <Rest/RestResponseCache.h>
 #include <Rest/Schema/IRestClient.h>
 #include <Rest/Schema/InformationResponseDeserializer.h>
 #include <AppInstallerVersions.h>
@@ -669,3 +670,158 @@ TEST_CASE("RestInformationCache_Cache_Overwrite", "[RestInformationCache]")
     REQUIRE(cachedValue.has_value());
     REQUIRE(identifier2 == cachedValue->SourceIdentifier);
 }
+
+namespace
+{
+    // Responds with the given body and headers, or 304 if the request carries the matching ETag; counts the requests made.
+    std::shared_ptr<TestRestRequestHandler> GetCachingRequestHandler(const utility::string_t& cacheControl, const utility::string_t& etag, std::shared_ptr<size_t> requestCount, std::shared_ptr<size_t> notModifiedCount)
+    {
+        return std::make_shared<TestRestRequestHandler>([=](web::http::http_request request) -> pplx::task<web::http::http_response>
+            {
+                ++*requestCount;
+
+                web::http::http_response response;
+                response.headers().set_content_type(web::http::details::mime_types::application_json);
+                response.headers().set_cache_control(cacheControl);
+
+                utility::string_t ifNoneMatch;
+                if (!etag.empty() && request.headers().match(L"If-None-Match", ifNoneMatch) && ifNoneMatch == etag)
+                {
+                    ++*notModifiedCount;
+                    response.set_status_code(web::http::status_codes::NotModified);
+                    return pplx::task_from_result(response);
+                }
+
+                if (!etag.empty())
+                {
+                    response.headers().add(L"ETag", etag);
+                }
+
+                response.set_body(web::json::value::parse(L"{ \"Data\": \"Response\" }"));
+                response.set_status_code(web::http::status_codes::OK);
+                return pplx::task_from_result(response);
+            });
+    }
+}
+
+TEST_CASE("RestResponseCache_MaxAge", "[RestResponseCache]")
+{
+    TestCommon::TempDirectory cacheDirectory("RestResponseCache");
+    auto requestCount = std::make_shared<size_t>(0);
+    auto notModifiedCount = std::make_shared<size_t>(0);
+
+    HttpClientHelper helper{ GetCachingRequestHandler(L"max-age=600", {}, requestCount, notModifiedCount) };
+    RestResponseCache cache{ cacheDirectory.GetPath() };
+    utility::string_t uri = L"https://test-url-com/packageManifests/Foo";
+
+    auto first = cache.HandleGet(helper, uri);
+    auto second = cache.HandleGet(helper, uri);
+
+    REQUIRE(first.has_value());
+    REQUIRE(second.has_value());
+    REQUIRE(first.value() == second.value());
+    REQUIRE(*requestCount == 1);
+
+    // A different request body is a different response.
+    cache.HandlePost(helper, uri, web::json::value::string(L"1"));
+    cache.HandlePost(helper, uri, web::json::value::string(L"2"));
+    REQUIRE(*requestCount == 3);
+}
+
+TEST_CASE("RestResponseCache_ETagRevalidation", "[RestResponseCache]")
+{
+    TestCommon::TempDirectory cacheDirectory("RestResponseCache");
+    auto requestCount = std::make_shared<size_t>(0);
+    auto notModifiedCount = std::make_shared<size_t>(0);
+
+    HttpClientHelper helper{ GetCachingRequestHandler(L"no-cache", L"\"v1\"", requestCount, notModifiedCount) };
+    RestResponseCache cache{ cacheDirectory.GetPath() };
+    utility::string_t uri = L"https://test-url-com/packageManifests/Foo";
+
+    auto first = cache.HandleGet(helper, uri);
+    auto second = cache.HandleGet(helper, uri);
+
+    REQUIRE(first.has_value());
+    REQUIRE(second.has_value());
+    REQUIRE(first.value() == second.value());
+    REQUIRE(*requestCount == 2);
+    REQUIRE(*notModifiedCount == 1);
+}
+
+TEST_CASE("RestResponseCache_NotStored", "[RestResponseCache]")
+{
+    TestCommon::TempDirectory cacheDirectory("RestResponseCache");
+    auto requestCount = std::make_shared<size_t>(0);
+    auto notModifiedCount = std::make_shared<size_t>(0);
+    utility::string_t uri = L"https://test-url-com/packageManifests/Foo";
+
+    SECTION("No store")
+    {
+        HttpClientHelper helper{ GetCachingRequestHandler(L"no-store", L"\"v1\"", requestCount, notModifiedCount) };
+        RestResponseCache cache{ cacheDirectory.GetPath() };
+
+        cache.HandleGet(helper, uri);
+        cache.HandleGet(helper, uri);
+    }
+    SECTION("No cache information")
+    {
+        HttpClientHelper helper{ GetCachingRequestHandler({}, {}, requestCount, notModifiedCount) };
+        RestResponseCache cache{ cacheDirectory.GetPath() };
+
+        cache.HandleGet(helper, uri);
+        cache.HandleGet(helper, uri);
+    }
+    SECTION("Authenticated")
+    {
+        HttpClientHelper helper{ GetCachingRequestHandler(L"max-age=600", {}, requestCount, notModifiedCount) };
+        RestResponseCache cache{ cacheDirectory.GetPath() };
+        HttpClientHelper::HttpRequestHeaders authHeaders{ { L"Authorization", L"Bearer token" } };
+
+        cache.HandleGet(helper, uri, {}, authHeaders);
+        cache.HandleGet(helper, uri, {}, authHeaders);
+    }
+
+    REQUIRE(*requestCount == 2);
+    REQUIRE(*notModifiedCount == 0);
+}
+
+TEST_CASE("RestResponseCache_Eviction", "[RestResponseCache]")
+{
+    TestCommon::TempDirectory cacheDirectory("RestResponseCache");
+    auto requestCount = std::make_shared<size_t>(0);
+    auto notModifiedCount = std::make_shared<size_t>(0);
+    HttpClientHelper helper{ GetCachingRequestHandler(L"max-age=600", {}, requestCount, notModifiedCount) };
+    utility::string_t uri = L"https://test-url-com/packageManifests/Foo";
+
+    SECTION("Over size")
+    {
+        // Every item is larger than the cache, so none is kept.
+        RestResponseCache cache{ cacheDirectory.GetPath(), 1 };
+
+        cache.HandleGet(helper, uri);
+        cache.HandleGet(helper, uri);
+
+        REQUIRE(*requestCount == 2);
+        REQUIRE(std::filesystem::is_empty(cacheDirectory.GetPath()));
+    }
+    SECTION("Over age")
+    {
+        RestResponseCache cache{ cacheDirectory.GetPath() };
+
+        cache.HandleGet(helper, uri);
+        REQUIRE(*requestCount == 1);
+
+        auto oldTime = std::filesystem::file_time_type::clock::now() - RestResponseCache::MaximumItemAge - std::chrono::hours{ 1 };
+        for (const auto& entry : std::filesystem::directory_iterator{ cacheDirectory.GetPath() })
+        {
+            std::filesystem::last_write_time(entry.path(), oldTime);
+        }
+
+        // Storing another item evicts the old one.
+        cache.HandleGet(helper, L"https://test-url-com/packageManifests/Bar");
+        REQUIRE(*requestCount == 2);
+
+        cache.HandleGet(helper, uri);
+        REQUIRE(*requestCount == 3);
+    }
+}
@@ -387,6 +387,54 @@ TEST_CASE("Search_GoodResponse_AllFields", "[RestSource][Interface_1_0]")
     REQUIRE(package.Versions.at(0).ProductCodes.at(1) == "pc2");
 }
 
+TEST_CASE("Search_GoodResponse_FieldOrderAndUnknownFields", "[RestSource][Interface_1_0]")
+{
+    utility::string_t sample = _XPLATSTR(
+        R"delimiter({
+            "Unknown" : { "Data" : [ { "PackageIdentifier": "not.a.package" } ], "ContinuationToken": "nested" },
+            "Data" : [
+               {
+              "Versions": [
+                {
+                    "PackageVersion": "1.0.0",
+                    "Unknown": [ { "PackageVersion": "2.0.0" } ],
+                    "ProductCodes" : [ "pc1", 2, null ]
+                }],
+              "Unknown": { "Versions": [] },
+              "PackageIdentifier": "git.package",
+              "PackageName": "package",
+              "Publisher": "git"
+            }]
+        })delimiter");
+
+    HttpClientHelper helper{ GetTestRestRequestHandler(web::http::status_codes::OK, std::move(sample)) };
+    Interface v1{ TestRestUriString, std::move(helper) };
+    Schema::IRestClient::SearchResult searchResponse = v1.Search({});
+    REQUIRE(searchResponse.Matches.size() == 1);
+    REQUIRE_FALSE(searchResponse.Truncated);
+    Schema::IRestClient::Package package = searchResponse.Matches.at(0);
+    REQUIRE(package.PackageInformation.PackageIdentifier == "git.package");
+    REQUIRE(package.Versions.size() == 1);
+    REQUIRE(package.Versions.at(0).VersionAndChannel.GetVersion().ToString() == "1.0.0");
+    REQUIRE(package.Versions.at(0).ProductCodes.size() == 1);
+    REQUIRE(package.Versions.at(0).ProductCodes.at(0) == "pc1");
+}
+
+TEST_CASE("Search_BadResponse_Malformed", "[RestSource][Interface_1_0]")
+{
+    utility::string_t sample = _XPLATSTR(R"delimiter({ "Data" : [ { "PackageIdentifier": )delimiter");
+
+    HttpClientHelper helper{ std::make_shared<TestRestRequestHandler>([sample](web::http::http_request) -> pplx::task<web::http::http_response>
+        {
+            web::http::http_response response;
+            response.set_body(sample, web::http::details::mime_types::application_json);
+            response.set_status_code(web::http::status_codes::OK);
+            return pplx::task_from_result(response);
+        }) };
+    Interface v1{ TestRestUriString, std::move(helper) };
+    REQUIRE_THROWS_HR(v1.Search({}), APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+}
+
 TEST_CASE("Search_GoodResponse_404AsEmpty", "[RestSource][Interface_1_0]")
 {
     utility::string_t notFoundResponse = _XPLATSTR(
@@ -433,6 +481,59 @@ TEST_CASE("Search_ContinuationToken", "[RestSource][Interface_1_0]")
     REQUIRE(resultsWithSize1.Matches.size() == requestWithSize1.MaximumResults);
 }
 
+TEST_CASE("Search_ContinuationToken_AllPages", "[RestSource][Interface_1_0]")
+{
+    constexpr int pageCount = 10;
+    std::atomic<int> requestCount = 0;
+
+    auto handler = std::make_shared<TestRestRequestHandler>([&](web::http::http_request request) ->
+        pplx::task<web::http::http_response>
+        {
+            ++requestCount;
+
+            // The continuation token is the index of the page being requested
+            int page = 0;
+            auto continuationToken = request.headers().find(L"ContinuationToken");
+            if (continuationToken != request.headers().end())
+            {
+                page = std::stoi(continuationToken->second);
+            }
+
+            web::json::value package;
+            package[L"PackageIdentifier"] = web::json::value::string(L"package." + std::to_wstring(page));
+            package[L"PackageName"] = web::json::value::string(L"package");
+            package[L"Publisher"] = web::json::value::string(L"publisher");
+            package[L"Versions"][0][L"PackageVersion"] = web::json::value::string(L"1.0.0");
+
+            web::json::value body;
+            body[L"Data"][0] = package;
+            if (page + 1 < pageCount)
+            {
+                body[L"ContinuationToken"] = web::json::value::string(std::to_wstring(page + 1));
+            }
+
+            web::http::http_response response;
+            response.set_body(body);
+            response.headers().set_content_type(web::http::details::mime_types::application_json);
+            response.set_status_code(web::http::status_codes::OK);
+            return pplx::task_from_result(response);
+        });
+
+    HttpClientHelper helper{ handler };
+    Interface v1{ TestRestUriString, std::move(helper) };
+    Schema::IRestClient::SearchResult results = v1.Search({});
+
+    REQUIRE(requestCount == pageCount);
+    REQUIRE_FALSE(results.Truncated);
+    REQUIRE(results.Matches.size() == pageCount);
+
+    // Pages parsed in the background must still be returned in order
+    for (int i = 0; i < pageCount; ++i)
+    {
+        REQUIRE(results.Matches[i].PackageInformation.PackageIdentifier == "package." + std::to_string(i));
+    }
+}
+
 TEST_CASE("Search_BadResponse_NoVersions", "[RestSource][Interface_1_0]")
 {
     utility::string_t sample = _XPLATSTR(
@@ -643,3 +744,55 @@ TEST_CASE("GetManifestByVersion_GoodResponse_MultipleVersions_VersionNotFound",
     std::optional<Manifest> manifest = v1.GetManifestByVersion("Foo.Bar", "7.0.0", "");
     REQUIRE_FALSE(manifest.has_value());
 }
+
+TEST_CASE("GetManifestByVersion_OnlyRequestedVersionParsed", "[RestSource][Interface_1_0]")
+{
+    // The 6.0.0 version is missing its installers; it must only be an error when it is requested.
+    utility::string_t sample = _XPLATSTR(
+        R"delimiter({
+        "Data": {
+            "PackageIdentifier": "Foo.Bar",
+            "Versions": [
+                {
+                    "PackageVersion": "6.0.0",
+                    "DefaultLocale": {
+                        "PackageLocale": "en-us",
+                        "Publisher": "Foo",
+                        "PackageName": "Bar",
+                        "License": "Foo bar license",
+                        "ShortDescription": "Foo bar description"
+                    }
+                },
+                {
+                    "PackageVersion": "5.0.0",
+                    "DefaultLocale": {
+                        "PackageLocale": "en-us",
+                        "Publisher": "Foo",
+                        "PackageName": "Bar",
+                        "License": "Foo bar license",
+                        "ShortDescription": "Foo bar description"
+                    },
+                    "Installers": [
+                        {
+                            "Architecture": "x64",
+                            "InstallerSha256": "011048877dfaef109801b3f3ab2b60afc74f3fc4f7b3430e0c897f5da1df84b6",
+                            "InstallerType": "exe",
+                            "InstallerUrl": "https://installer.example.com/foobar.exe"
+                        }
+                    ]
+                }
+            ]
+        }
+    })delimiter");
+
+    HttpClientHelper helper{ GetTestRestRequestHandler(web::http::status_codes::OK, std::move(sample)) };
+    Interface v1{ TestRestUriString, std::move(helper) };
+
+    std::optional<Manifest> manifest = v1.GetManifestByVersion("Foo.Bar", "5.0.0", "");
+    REQUIRE(manifest.has_value());
+    REQUIRE(manifest->Version == "5.0.0");
+    REQUIRE(manifest->Installers.size() == 1);
+
+    REQUIRE_THROWS_HR(v1.GetManifestByVersion("Foo.Bar", "6.0.0", ""), APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+    REQUIRE_THROWS_HR(v1.GetManifests("Foo.Bar"), APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
+}
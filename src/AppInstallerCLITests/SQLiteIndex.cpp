@@ -22,6 +22,7 @@
 #include <Microsoft/Schema/1_0/CommandsTable.h>
 #include <Microsoft/Schema/1_0/SearchResultsTable.h>
 #include <Microsoft/Schema/1_4/DependenciesTable.h>
+#include <Microsoft/Schema/1_8/Interface.h>
 #include <Microsoft/Schema/2_0/Interface.h>
 #include <Microsoft/Schema/2_0/PackageUpdateTrackingTable.h>
 
@@ -43,8 +44,8 @@ SQLiteIndex CreateTestIndex(const std::string& filePath, std::optional<SQLiteVer
     if (!version)
     {
         SQLiteVersion latestVersion{ 2, 0 };
-        SQLiteVersion versionMinus1 = SQLiteVersion{ 1, 7 };
-        SQLiteVersion versionMinus2 = SQLiteVersion{ 1, 6 };
+        SQLiteVersion versionMinus1 = SQLiteVersion{ 1, 8 };
+        SQLiteVersion versionMinus2 = SQLiteVersion{ 1, 7 };
 
         version = GENERATE_COPY(SQLiteVersion{ versionMinus2 }, SQLiteVersion{ versionMinus1 }, SQLiteVersion{ latestVersion });
     }
@@ -55,8 +56,8 @@ SQLiteIndex CreateTestIndex(const std::string& filePath, std::optional<SQLiteVer
 SQLiteVersion TestPrepareForRead(SQLiteIndex& index)
 {
     SQLiteVersion latestVersion{ 2, 0 };
-    SQLiteVersion versionMinus1 = SQLiteVersion{ 1, 7 };
-    SQLiteVersion versionMinus2 = SQLiteVersion{ 1, 6 };
+    SQLiteVersion versionMinus1 = SQLiteVersion{ 1, 8 };
+    SQLiteVersion versionMinus2 = SQLiteVersion{ 1, 7 };
 
     index.PrepareForPackaging();
 
@@ -1957,6 +1958,51 @@ TEST_CASE("SQLiteIndex_Search_VersionSorting", "[sqliteindex]")
     }
 }
 
+TEST_CASE("SQLiteIndex_VersionSortKeys", "[sqliteindex][V1_8]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    // Versions that differ only in implied parts, suffixes, and case; inserted out of order
+    SQLiteIndex index = SearchTestSetup(tempFile, {
+        { "Id", "Name", "Moniker", "1.0-rc", "", {}, {}, "Path1" },
+        { "Id", "Name", "Moniker", "1.0.0-RC2", "", {}, {}, "Path2" },
+        { "Id", "Name", "Moniker", "1", "", {}, {}, "Path3" },
+        { "Id", "Name", "Moniker", "1.0.1", "", {}, {}, "Path4" },
+        { "Id", "Name", "Moniker", "0.9", "", {}, {}, "Path5" },
+        { "Id", "Name", "Moniker", "1.0.0-rc.1", "", {}, {}, "Path6" },
+        { "Id", "Name", "Moniker", "Latest", "", {}, {}, "Path7" },
+        { "Id", "Name", "Moniker", "1.0-beta", "", {}, {}, "Path8" },
+        { "Id", "Name", "Moniker", "10", "", {}, {}, "Path9" },
+        { "Id", "Name", "Moniker", "1.0.0.0.1", "", {}, {}, "Path10" },
+        { "Id", "Name", "Moniker", "2.0-alpha", "", {}, {}, "Path11" },
+        { "Id", "Name", "Moniker", "Unknown", "", {}, {}, "Path12" },
+        }, SQLiteVersion{ 1, 8 });
+
+    std::vector<UtilityVersion> expected;
+    for (std::string_view version : { "1.0-rc", "1.0.0-RC2", "1", "1.0.1", "0.9", "1.0.0-rc.1", "Latest", "1.0-beta", "10", "1.0.0.0.1", "2.0-alpha", "Unknown" })
+    {
+        expected.emplace_back(std::string{ version });
+    }
+
+    std::sort(expected.begin(), expected.end(), [](const UtilityVersion& a, const UtilityVersion& b) { return b < a; });
+
+    SearchRequest request;
+    request.Filters.emplace_back(PackageMatchField::Id, MatchType::Exact, "Id");
+
+    auto results = index.Search(request);
+    REQUIRE(results.Matches.size() == 1);
+
+    auto result = index.GetVersionKeysById(results.Matches[0].first);
+    REQUIRE(result.size() == expected.size());
+
+    for (size_t i = 0; i < result.size(); ++i)
+    {
+        INFO(i);
+        REQUIRE(expected[i].ToString() == result[i].VersionAndChannel.GetVersion().ToString());
+    }
+}
+
 TEST_CASE("SQLiteIndex_PathString_VersionSorting", "[sqliteindex]")
 {
     TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
@@ -3576,7 +3622,7 @@ TEST_CASE("SQLiteIndex_MigrateTo_Data", "[sqliteindex][V2_0]")
 
     auto preMigrationVersion = index.GetVersion();
 
-    if (preMigrationVersion == SQLiteVersion{ 1, 7 })
+    if (preMigrationVersion == SQLiteVersion{ 1, 7 } || preMigrationVersion == SQLiteVersion{ 1, 8 })
     {
         REQUIRE(index.MigrateTo(SQLiteVersion{ 2, 0 }));
         REQUIRE(index.GetVersion() == SQLiteVersion{ 2, 0 });
@@ -3596,6 +3642,46 @@ TEST_CASE("SQLiteIndex_MigrateTo_Data", "[sqliteindex][V2_0]")
     }
 }
 
+TEST_CASE("SQLiteIndex_MigrateTo_LatestToV2", "[sqliteindex][V2_0]")
+{
+    TempFile tempFile{ "repolibtest_tempdb"s, ".db"s };
+    INFO("Using temporary file named: " << tempFile.GetPath());
+
+    {
+        SQLiteIndex index = SearchTestSetup(tempFile, {
+            { "Id", "Name", "Moniker", "1.0", "", {}, {}, "Path1" },
+            { "Id", "Name", "Moniker", "10.0", "", {}, {}, "Path2" },
+            { "Id", "Name", "Moniker", "2.0", "", {}, {}, "Path3" },
+            }, SQLiteVersion::Latest());
+
+        REQUIRE(index.MigrateTo(SQLiteVersion{ 2, 0 }));
+        REQUIRE(index.GetVersion() == SQLiteVersion{ 2, 0 });
+    }
+
+    {
+        // The version sort keys are kept through the migration.
+        Connection connection = Connection::Create(tempFile, Connection::OpenDisposition::ReadOnly);
+        REQUIRE(Schema::V1_8::Interface::HasVersionSortKeys(connection));
+    }
+
+    SQLiteIndex index = SQLiteIndex::Open(tempFile, SQLiteStorageBase::OpenDisposition::ReadWrite);
+    REQUIRE(index.GetVersion() == SQLiteVersion{ 2, 0 });
+
+    SearchRequest request;
+    request.Filters.emplace_back(PackageMatchField::Id, MatchType::Exact, "Id");
+
+    auto results = index.Search(request);
+    REQUIRE(results.Matches.size() == 1);
+
+    auto versionKeys = index.GetVersionKeysById(results.Matches[0].first);
+    REQUIRE(versionKeys.size() == 3);
+    REQUIRE(versionKeys[0].VersionAndChannel.GetVersion().ToString() == "10.0");
+    REQUIRE(versionKeys[1].VersionAndChannel.GetVersion().ToString() == "2.0");
+    REQUIRE(versionKeys[2].VersionAndChannel.GetVersion().ToString() == "1.0");
+
+    REQUIRE(index.CheckConsistency(true));
+}
+
 TEST_CASE("SQLiteIndex_Property_IntermediateFilePath", "[sqliteindex]")
 {
     SQLiteIndex index = SQLiteIndex::CreateNew(SQLITE_MEMORY_DB_CONNECTION_TARGET);
@@ -735,6 +735,90 @@ TEST_CASE("RepoSources_UpdateOnOpen", "[sources]")
     REQUIRE(sources[0].LastUpdateTime != ConvertUnixEpochToSystemClock(0));
 }
 
+TEST_CASE("RepoSources_UpdateOnOpen_InBackground", "[sources]")
+{
+    using namespace std::chrono_literals;
+
+    TestHook_ClearSourceFactoryOverrides();
+
+    TestUserSettings settings;
+    settings.Set<Setting::SourceUpdateInBackground>(true);
+
+    // The update waits for the open to return, which can only happen if it is not done before opening.
+    std::mutex lock;
+    std::condition_variable openReturned;
+    bool isOpenReturned = false;
+    bool updatedAfterOpen = false;
+
+    TestSourceFactory factory{ SourcesTestSource::Create };
+    factory.OnUpdate = [&](const SourceDetails&)
+        {
+            std::unique_lock<std::mutex> openLock{ lock };
+            updatedAfterOpen = openReturned.wait_for(openLock, 10s, [&]() { return isOpenReturned; });
+        };
+    factory.ShouldUpdateBeforeOpenResult = true;
+    TestHook_SetSourceFactoryOverride("testType", factory);
+
+    SetSetting(Stream::UserSources, s_SingleSource);
+
+    SECTION("Previously updated")
+    {
+        SetSetting(Stream::SourcesMetadata, s_SingleSourceMetadata);
+
+        {
+            ProgressCallback progress;
+            auto source = OpenSource("testName", progress);
+            REQUIRE(source);
+
+            {
+                std::lock_guard<std::mutex> openLock{ lock };
+                isOpenReturned = true;
+            }
+            openReturned.notify_all();
+
+            // Destroying the source waits for the background update.
+        }
+
+        REQUIRE(updatedAfterOpen);
+
+        std::vector<SourceDetails> sources = GetSources();
+        REQUIRE(sources[0].Name == "testName");
+        REQUIRE(sources[0].LastUpdateTime > ConvertUnixEpochToSystemClock(100));
+    }
+    SECTION("Never updated")
+    {
+        RemoveSetting(Stream::SourcesMetadata);
+
+        // Without data, the update must happen before the open returns.
+        bool isUpdated = false;
+        factory.OnUpdate = [&](const SourceDetails&)
+            {
+                std::lock_guard<std::mutex> openLock{ lock };
+                isUpdated = true;
+                updatedAfterOpen = isOpenReturned;
+            };
+        TestHook_SetSourceFactoryOverride("testType", factory);
+
+        ProgressCallback progress;
+        auto source = OpenSource("testName", progress);
+        REQUIRE(source);
+
+        bool updatedBeforeOpenReturned = false;
+        {
+            std::lock_guard<std::mutex> openLock{ lock };
+            updatedBeforeOpenReturned = isUpdated;
+            isOpenReturned = true;
+        }
+        openReturned.notify_all();
+
+        REQUIRE(updatedBeforeOpenReturned);
+        REQUIRE_FALSE(updatedAfterOpen);
+
+        std::vector<SourceDetails> sources = GetSources();
+        REQUIRE(sources[0].LastUpdateTime != ConvertUnixEpochToSystemClock(0));
+    }
+}
+
 TEST_CASE("RepoSources_DropSourceByName", "[sources]")
 {
     SetSetting(Stream::UserSources, s_ThreeSources);
@@ -1284,6 +1368,47 @@ TEST_CASE("RepoSources_OpenMultipleWithSingleFailure", "[sources]")
     REQUIRE(openFailure == FailingSourcesTestSource::FailingHR);
 }
 
+TEST_CASE("RepoSources_OpenMultipleConcurrently", "[sources]")
+{
+    using namespace std::chrono_literals;
+
+    // Each open waits for the other to start, which can only happen if they are opened concurrently.
+    std::mutex lock;
+    std::condition_variable allStarted;
+    size_t startedCount = 0;
+    bool openedConcurrently = true;
+
+    TestHook_ClearSourceFactoryOverrides();
+    TestSourceFactory factory{ [&](const SourceDetails& details)
+        {
+            std::unique_lock<std::mutex> startedLock{ lock };
+            ++startedCount;
+            allStarted.notify_all();
+
+            if (!allStarted.wait_for(startedLock, 10s, [&]() { return startedCount == 2; }))
+            {
+                openedConcurrently = false;
+            }
+
+            return SourcesTestSource::Create(details);
+        } };
+    TestHook_SetSourceFactoryOverride("testType", factory);
+
+    SetSetting(Stream::UserSources, s_TwoSource_AggregateSourceTest);
+
+    ProgressCallback progress;
+    auto result = OpenSource("", progress);
+
+    REQUIRE(result);
+    REQUIRE(openedConcurrently);
+
+    // The aggregated source keeps the configured order.
+    auto availableSources = result.GetAvailableSources();
+    REQUIRE(availableSources.size() == 2);
+    REQUIRE(availableSources[0].GetDetails().Name == "winget");
+    REQUIRE(availableSources[1].GetDetails().Name == "msstore");
+}
+
 TEST_CASE("RepoSources_OpenMultipleWithTotalFailure", "[sources]")
 {
     TestHook_ClearSourceFactoryOverrides();
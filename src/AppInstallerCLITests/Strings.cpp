@@ -5,6 +5,7 @@
 #include <AppInstallerStrings.h>
 #include <AppInstallerSHA256.h>
 #include <ExecutionReporter.h>
+#include <icu.h>
 
 using namespace std::string_literals;
 using namespace std::string_view_literals;
@@ -83,6 +84,17 @@ TEST_CASE("Normalize", "[strings]")
 
     // Ligature fi => f + i
     REQUIRE(Normalize(u8"\xFB01") == u8"fi");
+
+    // Already normalized values are unchanged
+    REQUIRE(Normalize("te\0st"sv) == "te\0st"sv);
+    REQUIRE(Normalize("\xC3\x84") == "\xC3\x84");
+    REQUIRE(Normalize("te\xe6\xb5\x8bs\xe8\xaf\x95t") == "te\xe6\xb5\x8bs\xe8\xaf\x95t");
+
+    // Only NFKC changes compatibility characters
+    REQUIRE(Normalize(u8"\xFB01", NORM_FORM::NormalizationC) == u8"\xFB01");
+
+    // Invalid sequences are replaced as before
+    REQUIRE(Normalize("a\xC3"sv) == ConvertToUTF8(ConvertToUTF16("a\xC3"sv)));
 }
 
 TEST_CASE("NormalizedString", "[strings]")
@@ -144,6 +156,128 @@ TEST_CASE("FoldCase", "[strings]")
     REQUIRE(FoldCase(u8"foldc\x430se"sv) == FoldCase(u8"FOLDC\x410SE"sv));
 }
 
+namespace
+{
+    // Folds the case of the input with ICU directly, as FoldCase does for input that is not ASCII.
+    std::string ICUFoldCase(std::string_view input)
+    {
+        if (input.empty())
+        {
+            return {};
+        }
+
+        UErrorCode errorCode = U_ZERO_ERROR;
+        wil::unique_any<UCaseMap*, decltype(ucasemap_close), &ucasemap_close> caseMap{ ucasemap_open(nullptr, U_FOLD_CASE_DEFAULT, &errorCode) };
+        REQUIRE(U_SUCCESS(errorCode));
+
+        std::string result(input.size() * 3, '\0');
+        int32_t cch = ucasemap_utf8FoldCase(caseMap.get(), &result[0], static_cast<int32_t>(result.size()), input.data(), static_cast<int32_t>(input.size()), &errorCode);
+        REQUIRE(U_SUCCESS(errorCode));
+
+        result.resize(cch);
+        while (!result.empty() && result.back() == '\0')
+        {
+            result.pop_back();
+        }
+
+        return result;
+    }
+
+    std::string CreateRandomString(std::mt19937& random, bool asciiOnly)
+    {
+        std::string result(std::uniform_int_distribution<size_t>{ 0, 40 }(random), '\0');
+        std::uniform_int_distribution<int> byteDistribution{ 0, asciiOnly ? 0x7F : 0xFF };
+
+        for (char& c : result)
+        {
+            c = static_cast<char>(byteDistribution(random));
+        }
+
+        return result;
+    }
+
+    std::string ChangeCaseRandomly(std::mt19937& random, std::string value)
+    {
+        for (char& c : value)
+        {
+            if (random() % 2)
+            {
+                c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+            }
+        }
+
+        return value;
+    }
+
+    std::string ToLowerReference(std::string_view value)
+    {
+        std::string result{ value };
+        std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return result;
+    }
+}
+
+TEST_CASE("FoldCase_ASCIIMatchesICU", "[strings]")
+{
+    std::mt19937 random{ 42 };
+
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        std::string input = CreateRandomString(random, true);
+        INFO(ConvertToHexString(std::vector<uint8_t>{ input.begin(), input.end() }));
+
+        REQUIRE(FoldCase(std::string_view{ input }) == ICUFoldCase(input));
+    }
+}
+
+TEST_CASE("ICUCaseInsensitiveEquals_MatchesFoldCase", "[strings]")
+{
+    std::mt19937 random{ 42 };
+
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        std::string a = CreateRandomString(random, true);
+        std::string b = ChangeCaseRandomly(random, a);
+
+        // Occasionally make the values differ, or include non-ASCII characters
+        if (random() % 4 == 0 && !b.empty())
+        {
+            b[random() % b.size()] = static_cast<char>(random() % 0x80);
+        }
+
+        if (random() % 8 == 0)
+        {
+            // U+00D6 and U+00F6, which fold to the same value
+            a += "\xC3\x96";
+            b += "\xC3\xB6";
+        }
+
+        INFO(ConvertToHexString(std::vector<uint8_t>{ a.begin(), a.end() }) << " vs " << ConvertToHexString(std::vector<uint8_t>{ b.begin(), b.end() }));
+        REQUIRE(ICUCaseInsensitiveEquals(a, b) == (ICUFoldCase(a) == ICUFoldCase(b)));
+    }
+}
+
+TEST_CASE("CaseInsensitiveEquals_MatchesToLower", "[strings]")
+{
+    std::mt19937 random{ 42 };
+
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        std::string a = CreateRandomString(random, false);
+        std::string b = ChangeCaseRandomly(random, a);
+
+        if (random() % 4 == 0 && !b.empty())
+        {
+            b[random() % b.size()] = static_cast<char>(random() % 0x100);
+        }
+
+        INFO(ConvertToHexString(std::vector<uint8_t>{ a.begin(), a.end() }) << " vs " << ConvertToHexString(std::vector<uint8_t>{ b.begin(), b.end() }));
+        REQUIRE(ToLower(a) == ToLowerReference(a));
+        REQUIRE(CaseInsensitiveEquals(a, b) == (ToLowerReference(a) == ToLowerReference(b)));
+        REQUIRE(CaseInsensitiveStartsWith(a, b.substr(0, b.size() / 2)) == (ToLowerReference(a).rfind(ToLowerReference(b.substr(0, b.size() / 2)), 0) == 0));
+    }
+}
+
 TEST_CASE("ExpandEnvironmentVariables", "[strings]")
 {
     wchar_t buffer[MAX_PATH];
@@ -0,0 +1,135 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TestCommon.h"
+#include <winget/Timing.h>
+
+using namespace AppInstaller::Timing;
+using namespace TestCommon;
+using namespace std::chrono_literals;
+
+namespace
+{
+    // Resets the collected timings and enables collection for the lifetime of the object.
+    struct TimingTestScope
+    {
+        TimingTestScope(bool enabled = true)
+        {
+            Reset();
+            SetEnabled(enabled);
+        }
+
+        ~TimingTestScope()
+        {
+            SetEnabled(false);
+            Reset();
+        }
+    };
+}
+
+TEST_CASE("Timing_DisabledRecordsNothing", "[timing]")
+{
+    TimingTestScope scope{ false };
+
+    REQUIRE_FALSE(IsEnabled());
+
+    {
+        ScopedTimer timer{ Phase::Search };
+    }
+    Record(Phase::Download, 5ms);
+
+    REQUIRE(GetSummary().empty());
+}
+
+TEST_CASE("Timing_RecordAggregates", "[timing]")
+{
+    TimingTestScope scope;
+
+    Record(Phase::Hash, 1ms);
+    Record(Phase::Search, 5ms);
+    Record(Phase::Search, 10ms);
+
+    auto summary = GetSummary();
+    REQUIRE(summary.size() == 2);
+
+    // The summary is in phase order rather than the order of recording.
+    REQUIRE(summary[0].Phase == Phase::Search);
+    REQUIRE(summary[0].Count == 2);
+    REQUIRE(summary[0].Total == 15ms);
+    REQUIRE(summary[0].Maximum == 10ms);
+
+    REQUIRE(summary[1].Phase == Phase::Hash);
+    REQUIRE(summary[1].Count == 1);
+    REQUIRE(summary[1].Total == 1ms);
+    REQUIRE(summary[1].Maximum == 1ms);
+
+    Reset();
+    REQUIRE(GetSummary().empty());
+}
+
+TEST_CASE("Timing_ScopedTimerStop", "[timing]")
+{
+    TimingTestScope scope;
+
+    {
+        ScopedTimer timer{ Phase::ManifestParse };
+        timer.Stop();
+        timer.Stop();
+    }
+
+    auto summary = GetSummary();
+    REQUIRE(summary.size() == 1);
+    REQUIRE(summary[0].Phase == Phase::ManifestParse);
+    REQUIRE(summary[0].Count == 1);
+    REQUIRE(summary[0].Total == summary[0].Maximum);
+}
+
+TEST_CASE("Timing_Concurrent", "[timing]")
+{
+    TimingTestScope scope;
+
+    constexpr size_t threadCount = 8;
+    constexpr size_t recordsPerThread = 1000;
+
+    std::vector<std::future<void>> futures;
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        futures.emplace_back(std::async(std::launch::async, [i]()
+            {
+                for (size_t j = 0; j < recordsPerThread; ++j)
+                {
+                    Record(Phase::Correlation, std::chrono::microseconds{ i + 1 });
+                }
+            }));
+    }
+
+    for (auto& future : futures)
+    {
+        future.get();
+    }
+
+    auto summary = GetSummary();
+    REQUIRE(summary.size() == 1);
+    REQUIRE(summary[0].Count == threadCount * recordsPerThread);
+    REQUIRE(summary[0].Total == std::chrono::microseconds{ recordsPerThread * threadCount * (threadCount + 1) / 2 });
+    REQUIRE(summary[0].Maximum == std::chrono::microseconds{ threadCount });
+}
+
+TEST_CASE("Timing_SummaryAsJson", "[timing]")
+{
+    TimingTestScope scope;
+
+    Record(Phase::Download, 2500us);
+    Record(Phase::Download, 500us);
+
+    Json::Value root = ConvertToJson(GetSummaryAsJson());
+
+    REQUIRE(root["phases"].isArray());
+    REQUIRE(root["phases"].size() == 1);
+
+    const Json::Value& download = root["phases"][0];
+    REQUIRE(download["phase"].asString() == ToString(Phase::Download));
+    REQUIRE(download["count"].asUInt64() == 2);
+    REQUIRE(download["totalMs"].asDouble() == 3.0);
+    REQUIRE(download["maxMs"].asDouble() == 2.5);
+}
@@ -3,10 +3,12 @@
 #include "pch.h"
 #include "TestCommon.h"
 #include <AppInstallerRuntime.h>
+#include <AppInstallerStrings.h>
 #include <AppInstallerVersions.h>
 
 using namespace AppInstaller;
 using namespace AppInstaller::Utility;
+using namespace std::string_view_literals;
 
 
 TEST_CASE("VersionParse", "[versions]")
@@ -190,6 +192,262 @@ TEST_CASE("VersionCompare", "[versions]")
     RequireLessThan("alpha", "beta");
 }
 
+namespace
+{
+    // A direct implementation of the version parsing and comparison rules, without any of the optimizations of Version.
+    struct ReferenceVersion
+    {
+        struct Part
+        {
+            uint64_t Integer = 0;
+            std::string Other;
+            std::string FoldedOther;
+        };
+
+        ReferenceVersion(std::string version)
+        {
+            version = Trim(version);
+
+            if (CaseInsensitiveStartsWith(version, "< "))
+            {
+                Approximate = Version::ApproximateComparator::LessThan;
+                version = version.substr(2);
+            }
+            else if (CaseInsensitiveStartsWith(version, "> "))
+            {
+                Approximate = Version::ApproximateComparator::GreaterThan;
+                version = version.substr(2);
+            }
+
+            size_t digitPos = version.find_first_of("0123456789");
+            size_t splitPos = version.find('.');
+            if (digitPos != std::string::npos && (splitPos == std::string::npos || digitPos < splitPos))
+            {
+                version.erase(0, digitPos);
+            }
+
+            for (const std::string& partString : Split(version, '.'))
+            {
+                std::string trimmed = Trim(partString);
+                Part part;
+                char* end = nullptr;
+                errno = 0;
+                part.Integer = strtoull(trimmed.c_str(), &end, 10);
+
+                if (errno == ERANGE)
+                {
+                    part.Integer = 0;
+                    part.Other = trimmed;
+                }
+                else
+                {
+                    part.Other = end;
+                }
+
+                part.FoldedOther = FoldCase(std::string_view{ part.Other });
+                Parts.emplace_back(std::move(part));
+            }
+
+            while (!Parts.empty() && Parts.back().Integer == 0 && Parts.back().Other.empty())
+            {
+                Parts.pop_back();
+            }
+        }
+
+        bool IsSentinel(std::string_view value) const
+        {
+            return Parts.size() == 1 && Parts[0].Integer == 0 && CaseInsensitiveEquals(Parts[0].Other, value);
+        }
+
+        static bool PartLessThan(const Part& a, const Part& b)
+        {
+            if (a.Integer != b.Integer)
+            {
+                return a.Integer < b.Integer;
+            }
+            else if (a.Other.empty())
+            {
+                return false;
+            }
+            else if (b.Other.empty())
+            {
+                return true;
+            }
+
+            return a.FoldedOther < b.FoldedOther;
+        }
+
+        bool ApproximateLessThan(const ReferenceVersion& other) const
+        {
+            return (Approximate == Version::ApproximateComparator::LessThan && other.Approximate != Version::ApproximateComparator::LessThan) ||
+                (Approximate == Version::ApproximateComparator::None && other.Approximate == Version::ApproximateComparator::GreaterThan);
+        }
+
+        bool operator<(const ReferenceVersion& other) const
+        {
+            for (std::string_view sentinel : { "Latest"sv, "Unknown"sv })
+            {
+                bool thisIsSentinel = IsSentinel(sentinel);
+                bool otherIsSentinel = other.IsSentinel(sentinel);
+
+                if (thisIsSentinel && otherIsSentinel)
+                {
+                    return ApproximateLessThan(other);
+                }
+                else if (thisIsSentinel || otherIsSentinel)
+                {
+                    // Latest sorts above everything, Unknown below
+                    return (sentinel == "Latest"sv ? otherIsSentinel : thisIsSentinel);
+                }
+            }
+
+            const Part emptyPart{};
+            for (size_t i = 0; i < std::max(Parts.size(), other.Parts.size()); ++i)
+            {
+                const Part& a = (i < Parts.size() ? Parts[i] : emptyPart);
+                const Part& b = (i < other.Parts.size() ? other.Parts[i] : emptyPart);
+
+                if (PartLessThan(a, b))
+                {
+                    return true;
+                }
+                else if (PartLessThan(b, a))
+                {
+                    return false;
+                }
+            }
+
+            return ApproximateLessThan(other);
+        }
+
+        bool operator==(const ReferenceVersion& other) const
+        {
+            if (Approximate != other.Approximate)
+            {
+                return false;
+            }
+
+            if ((IsSentinel("Latest"sv) && other.IsSentinel("Latest"sv)) || (IsSentinel("Unknown"sv) && other.IsSentinel("Unknown"sv)))
+            {
+                return true;
+            }
+
+            return Parts.size() == other.Parts.size() &&
+                std::equal(Parts.begin(), Parts.end(), other.Parts.begin(), [](const Part& a, const Part& b) { return a.Integer == b.Integer && a.FoldedOther == b.FoldedOther; });
+        }
+
+        Version::ApproximateComparator Approximate = Version::ApproximateComparator::None;
+        std::vector<Part> Parts;
+    };
+
+    std::string CreateRandomVersionString(std::mt19937& random)
+    {
+        static constexpr std::string_view s_partValues[] = {
+            "0"sv, "00"sv, "1"sv, "01"sv, "2"sv, "10"sv, "65535"sv, "4294967296"sv, "18446744073709551615"sv, "18446744073709551616"sv,
+            "99999999999999999999"sv, "1-rc"sv, "1-RC"sv, "2-beta"sv, "a"sv, "B"sv, "-1"sv, "+2"sv, " 3"sv, "4 "sv, ""sv, "latest"sv, "Unknown"sv,
+        };
+        static constexpr std::string_view s_prefixes[] = { ""sv, ""sv, ""sv, "v"sv, "< "sv, "> "sv, "Version "sv };
+
+        std::string result{ s_prefixes[std::uniform_int_distribution<size_t>{ 0, std::size(s_prefixes) - 1 }(random)] };
+
+        size_t partCount = std::uniform_int_distribution<size_t>{ 1, 6 }(random);
+        for (size_t i = 0; i < partCount; ++i)
+        {
+            if (i != 0)
+            {
+                result += '.';
+            }
+
+            result += s_partValues[std::uniform_int_distribution<size_t>{ 0, std::size(s_partValues) - 1 }(random)];
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("VersionCompare_MatchesReference", "[versions]")
+{
+    std::mt19937 random{ 42 };
+    size_t comparisons = 0;
+
+    while (comparisons < 20000)
+    {
+        std::string stringA = CreateRandomVersionString(random);
+        std::string stringB = CreateRandomVersionString(random);
+
+        Version versionA;
+        Version versionB;
+
+        try
+        {
+            versionA = Version{ stringA };
+            versionB = Version{ stringB };
+        }
+        catch (...)
+        {
+            // Approximate Unknown versions are not allowed
+            continue;
+        }
+
+        ReferenceVersion referenceA{ stringA };
+        ReferenceVersion referenceB{ stringB };
+
+        INFO(stringA << " vs " << stringB);
+        REQUIRE((versionA < versionB) == (referenceA < referenceB));
+        REQUIRE((versionB < versionA) == (referenceB < referenceA));
+        REQUIRE((versionA == versionB) == (referenceA == referenceB));
+
+        ++comparisons;
+    }
+}
+
+TEST_CASE("VersionSortKey_MatchesCompare", "[versions]")
+{
+    std::mt19937 random{ 7 };
+    size_t comparisons = 0;
+
+    while (comparisons < 20000)
+    {
+        std::string stringA = CreateRandomVersionString(random);
+        std::string stringB = CreateRandomVersionString(random);
+
+        Version versionA;
+        Version versionB;
+
+        try
+        {
+            versionA = Version{ stringA };
+            versionB = Version{ stringB };
+        }
+        catch (...)
+        {
+            // Approximate Unknown versions are not allowed
+            continue;
+        }
+
+        std::vector<uint8_t> keyA = versionA.GetSortKey();
+        std::vector<uint8_t> keyB = versionB.GetSortKey();
+
+        INFO(stringA << " vs " << stringB);
+        REQUIRE((versionA < versionB) == (keyA < keyB));
+        REQUIRE((versionB < versionA) == (keyB < keyA));
+
+        ++comparisons;
+    }
+}
+
+TEST_CASE("VersionSortKey_Padding", "[versions]")
+{
+    // Implied empty parts must compare correctly against explicit parts on the other side
+    REQUIRE(Version{ "1" }.GetSortKey() == Version{ "1.0.0" }.GetSortKey());
+    REQUIRE(Version{ "1" }.GetSortKey() < Version{ "1.0.1" }.GetSortKey());
+    REQUIRE(Version{ "1.0.0-rc" }.GetSortKey() < Version{ "1" }.GetSortKey());
+    REQUIRE(Version{ "1.0-rc" }.GetSortKey() < Version{ "1.0.0-rc" }.GetSortKey());
+    REQUIRE(Version{ "1.0.1" }.GetSortKey() < Version{ "1.1" }.GetSortKey());
+    REQUIRE(Version::CreateUnknown().GetSortKey() < Version{ "0-alpha" }.GetSortKey());
+    REQUIRE(Version{ "99999" }.GetSortKey() < Version::CreateLatest().GetSortKey());
+}
+
 TEST_CASE("VersionAndChannelSort", "[versions]")
 {
     std::vector<VersionAndChannel> sortedList =
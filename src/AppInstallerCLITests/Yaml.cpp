@@ -178,3 +178,57 @@ TEST_CASE("YamlContainsTooManyNestedLayers", "[YAML]")
 {
     REQUIRE_THROWS_HR(Load(TestDataFile("ContainsTooManyNestedLayers.yaml")), APPINSTALLER_CLI_ERROR_YAML_DOC_BUILD_FAILED);
 }
+
+TEST_CASE("YamlScalarAsView", "[YAML]")
+{
+    const auto document = Load(TestDataFile("Node-Mapping.yaml"));
+
+    const auto& node = document["key"];
+    REQUIRE(node.as_view() == "value");
+    REQUIRE(node.as_view() == node.as<std::string>());
+
+    REQUIRE_THROWS_HR(document.as_view(), APPINSTALLER_CLI_ERROR_YAML_INVALID_OPERATION);
+}
+
+TEST_CASE("YamlBinaryRoundTrip", "[YAML]")
+{
+    auto document = LoadDocument(TestDataFile("Node-Types.yaml"));
+    std::string binary = ConvertToBinary(document);
+
+    auto loaded = LoadDocumentFromBinary(binary);
+    REQUIRE(loaded.GetSchemaHeader().SchemaHeader == document.GetSchemaHeader().SchemaHeader);
+
+    const Node& original = document.GetRoot();
+    const Node& root = loaded.GetRoot();
+    REQUIRE(root.IsMap());
+    REQUIRE(root.size() == original.size());
+
+    for (const auto& keyValuePair : original.Mapping())
+    {
+        std::string_view key = keyValuePair.first.as_view();
+        INFO(key);
+        REQUIRE(root[key].GetTagType() == keyValuePair.second.GetTagType());
+        REQUIRE(root[key].as_view() == keyValuePair.second.as_view());
+        REQUIRE(root[key].Mark().line == keyValuePair.second.Mark().line);
+    }
+}
+
+TEST_CASE("YamlBinaryInvalidData", "[YAML]")
+{
+    std::string binary = ConvertToBinary(LoadDocument(TestDataFile("Node-Mapping.yaml")));
+
+    REQUIRE_THROWS_HR(LoadDocumentFromBinary(binary.substr(0, binary.size() - 1)), APPINSTALLER_CLI_ERROR_YAML_INVALID_DATA);
+    REQUIRE_THROWS_HR(LoadDocumentFromBinary(binary + "x"), APPINSTALLER_CLI_ERROR_YAML_INVALID_DATA);
+    REQUIRE_THROWS_HR(LoadDocumentFromBinary("WGYB"), APPINSTALLER_CLI_ERROR_YAML_INVALID_DATA);
+}
+
+TEST_CASE("YamlBinaryNestingDepth", "[YAML]")
+{
+    auto createNested = [](size_t depth) { return std::string(depth, '[') + std::string(depth, ']'); };
+
+    std::string shallow = ConvertToBinary(LoadDocument(createNested(32)));
+    REQUIRE(LoadDocumentFromBinary(shallow).GetRoot().IsSequence());
+
+    std::string deep = ConvertToBinary(LoadDocument(createNested(100)));
+    REQUIRE_THROWS_HR(LoadDocumentFromBinary(deep), APPINSTALLER_CLI_ERROR_YAML_INVALID_DATA);
+}
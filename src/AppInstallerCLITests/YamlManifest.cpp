@@ -1379,6 +1379,55 @@ TEST_CASE("ManifestApplyLocale", "[ManifestValidation]")
     REQUIRE(manifest.CurrentLocalization.Get<Localization::Publisher>() == "es-MX publisher");
 }
 
+TEST_CASE("ManifestApplyLocale_DeferredLocalizations", "[ManifestValidation]")
+{
+    ManifestValidateOption validateOption;
+    validateOption.DeferLocalizations = true;
+    Manifest manifest = YamlParser::CreateFromPath(TestDataFile("Manifest-Good-MultiLocale.yaml"), validateOption);
+
+    REQUIRE(manifest.Localizations.empty());
+    REQUIRE(manifest.HasDeferredLocalizations());
+
+    manifest.ApplyLocale("en-US");
+    REQUIRE(manifest.CurrentLocalization.Locale == "en-GB");
+    REQUIRE(manifest.CurrentLocalization.Get<Localization::PackageName>() == "en-GB package name");
+    REQUIRE(manifest.CurrentLocalization.Get<Localization::Publisher>() == "en-GB publisher");
+
+    manifest.ApplyLocale("fr-FR");
+    REQUIRE(manifest.CurrentLocalization.Locale == "fr-FR");
+    REQUIRE(manifest.CurrentLocalization.Get<Localization::PackageName>() == "fr-FR package name");
+    REQUIRE(manifest.CurrentLocalization.Get<Localization::Publisher>() == "es-MX publisher");
+
+    size_t localizationCount = 0;
+    manifest.ForEachLocalization([&](const ManifestLocalization&) { ++localizationCount; });
+    REQUIRE(localizationCount == 2);
+
+    std::vector<string_t> expectedLocales{ "en-GB", "fr-FR" };
+    REQUIRE(manifest.GetLocalizationLocales() == expectedLocales);
+
+    manifest.MaterializeLocalizations();
+    REQUIRE_FALSE(manifest.HasDeferredLocalizations());
+    REQUIRE(manifest.Localizations.size() == 2);
+    REQUIRE(manifest.Localizations.at(0).Locale == "en-GB");
+    REQUIRE(manifest.Localizations.at(1).Locale == "fr-FR");
+}
+
+TEST_CASE("ManifestGetLocalizationLocales_DeferredLocalizations", "[ManifestValidation]")
+{
+    Manifest eagerManifest = YamlParser::CreateFromPath(TestDataFile("Manifest-Good-MultiLocale.yaml"));
+
+    ManifestValidateOption validateOption;
+    validateOption.DeferLocalizations = true;
+    Manifest deferredManifest = YamlParser::CreateFromPath(TestDataFile("Manifest-Good-MultiLocale.yaml"), validateOption);
+
+    // The locales are the same whether or not the localizations were deferred, and reading them does not populate any.
+    std::vector<string_t> expectedLocales{ "en-GB", "fr-FR" };
+    REQUIRE(eagerManifest.GetLocalizationLocales() == expectedLocales);
+    REQUIRE(deferredManifest.GetLocalizationLocales() == expectedLocales);
+    REQUIRE(deferredManifest.Localizations.empty());
+    REQUIRE(deferredManifest.HasDeferredLocalizations());
+}
+
 TEST_CASE("ManifestLocalizationValidation", "[ManifestValidation]")
 {
     Manifest manifest = YamlParser::CreateFromPath(TestDataFile("Manifest-Good-MultiLocale.yaml"));
@@ -6,6 +6,7 @@
 #include "Public/AppInstallerSHA256.h"
 #include "Public/AppInstallerStrings.h"
 #include "winget/UserSettings.h"
+#include <winget/Filesystem.h>
 
 // TODO: Get this from the Windows SDK when available
 #define DODownloadProperty_HttpRedirectionTarget static_cast<DODownloadProperty>(DODownloadProperty_NonVolatile + 1)
@@ -480,13 +481,20 @@ namespace AppInstaller::Utility
             download.Finalize();
             AICLI_LOG(Core, Info, << "Download completed.");
 
-            std::ifstream inStream{ dest, std::ifstream::binary };
-            auto hashDetails = SHA256::ComputeHashDetails(inStream);
+            // Since we cannot pre-apply to the file with DO, post-apply the MotW to the file before it is hashed.
+            ApplyMotwIfApplicable(dest, URLZONE_INTERNET);
+
+            // The handle denies writes while the file is hashed, so the identity captured through it is that of the hashed contents.
+            wil::unique_hfile file{ CreateFileW(dest.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_OVERLAPPED | FILE_FLAG_SEQUENTIAL_SCAN, nullptr) };
+            THROW_LAST_ERROR_IF(!file);
+
+            auto hashDetails = SHA256::ComputeHashDetailsFromOverlappedHandle(file.get());
 
             DownloadResult result;
             result.Sha256Hash = std::move(hashDetails.Hash);
             result.SizeInBytes = hashDetails.SizeInBytes;
             result.ContentType = ExtractContentType(responseHeaders);
+            result.FileIdentity = Filesystem::GetFileIdentity(file.get());
 
             return result;
         }
@@ -0,0 +1,165 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "DownloadSegmentMap.h"
+#include "Public/AppInstallerLogging.h"
+
+using namespace std::string_view_literals;
+
+namespace AppInstaller::Utility
+{
+    namespace
+    {
+        constexpr std::string_view s_ValidatorName = "validator"sv;
+        constexpr std::string_view s_ContentSizeName = "size"sv;
+        constexpr std::string_view s_SegmentsName = "segments"sv;
+        constexpr std::string_view s_OffsetName = "offset"sv;
+        constexpr std::string_view s_SegmentSizeName = "length"sv;
+        constexpr std::string_view s_CompletedName = "completed"sv;
+
+        std::optional<uint64_t> GetUInt64(const Json::Value& node, std::string_view name)
+        {
+            const Json::Value& value = node[std::string{ name }];
+            if (value.isUInt64())
+            {
+                return value.asUInt64();
+            }
+
+            return std::nullopt;
+        }
+    }
+
+    DownloadSegmentMap::DownloadSegmentMap(std::string validator, uint64_t contentSize, uint64_t segmentSize) :
+        Validator(std::move(validator)), ContentSize(contentSize)
+    {
+        THROW_HR_IF(E_INVALIDARG, segmentSize == 0);
+
+        for (uint64_t offset = 0; offset < contentSize; offset += segmentSize)
+        {
+            Segment segment;
+            segment.Offset = offset;
+            segment.Size = std::min(segmentSize, contentSize - offset);
+            Segments.emplace_back(segment);
+        }
+    }
+
+    std::filesystem::path DownloadSegmentMap::GetPathFor(const std::filesystem::path& target)
+    {
+        std::filesystem::path result = target;
+        result += ".segments";
+        return result;
+    }
+
+    std::optional<DownloadSegmentMap> DownloadSegmentMap::Load(const std::filesystem::path& path, std::string_view validator, uint64_t contentSize) try
+    {
+        std::ifstream stream{ path, std::ios_base::in | std::ios_base::binary };
+        if (!stream)
+        {
+            return std::nullopt;
+        }
+
+        Json::Value root;
+        Json::CharReaderBuilder builder;
+        std::string errors;
+        if (!Json::parseFromStream(builder, stream, &root, &errors))
+        {
+            AICLI_LOG(Core, Warning, << "Download segment map could not be parsed: " << errors);
+            return std::nullopt;
+        }
+
+        const Json::Value& validatorValue = root[std::string{ s_ValidatorName }];
+        if (validator.empty() || !validatorValue.isString() || validatorValue.asString() != validator ||
+            GetUInt64(root, s_ContentSizeName) != contentSize)
+        {
+            AICLI_LOG(Core, Info, << "Download segment map is for different content");
+            return std::nullopt;
+        }
+
+        DownloadSegmentMap result;
+        result.Validator = validator;
+        result.ContentSize = contentSize;
+
+        // The segments must cover the content exactly, in order.
+        uint64_t expectedOffset = 0;
+        for (const Json::Value& segmentValue : root[std::string{ s_SegmentsName }])
+        {
+            Segment segment;
+            segment.Offset = GetUInt64(segmentValue, s_OffsetName).value_or(UINT64_MAX);
+            segment.Size = GetUInt64(segmentValue, s_SegmentSizeName).value_or(0);
+            segment.Completed = GetUInt64(segmentValue, s_CompletedName).value_or(0);
+
+            if (segment.Offset != expectedOffset || segment.Size == 0 || segment.Size > contentSize - segment.Offset || segment.Completed > segment.Size)
+            {
+                AICLI_LOG(Core, Warning, << "Download segment map contains an invalid segment");
+                return std::nullopt;
+            }
+
+            expectedOffset += segment.Size;
+            result.Segments.emplace_back(segment);
+        }
+
+        if (expectedOffset != contentSize)
+        {
+            AICLI_LOG(Core, Warning, << "Download segment map does not cover the content");
+            return std::nullopt;
+        }
+
+        return result;
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION_MSG("DownloadSegmentMap::Load exception");
+        return std::nullopt;
+    }
+
+    void DownloadSegmentMap::Save(const std::filesystem::path& path) const
+    {
+        Json::Value root{ Json::objectValue };
+        root[std::string{ s_ValidatorName }] = Validator;
+        root[std::string{ s_ContentSizeName }] = Json::Value{ static_cast<Json::UInt64>(ContentSize) };
+
+        Json::Value& segmentsValue = root[std::string{ s_SegmentsName }];
+        segmentsValue = Json::Value{ Json::arrayValue };
+
+        for (const Segment& segment : Segments)
+        {
+            Json::Value segmentValue{ Json::objectValue };
+            segmentValue[std::string{ s_OffsetName }] = Json::Value{ static_cast<Json::UInt64>(segment.Offset) };
+            segmentValue[std::string{ s_SegmentSizeName }] = Json::Value{ static_cast<Json::UInt64>(segment.Size) };
+            segmentValue[std::string{ s_CompletedName }] = Json::Value{ static_cast<Json::UInt64>(segment.Completed) };
+            segmentsValue.append(std::move(segmentValue));
+        }
+
+        Json::StreamWriterBuilder writerBuilder;
+        writerBuilder["indentation"] = "";
+
+        // Write to the side and move into place so that an interruption never leaves a partial map.
+        std::filesystem::path tempPath = path;
+        tempPath += ".tmp";
+
+        {
+            std::ofstream stream{ tempPath, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary };
+            stream << Json::writeString(writerBuilder, root);
+            THROW_HR_IF(E_FAIL, !stream);
+        }
+
+        std::filesystem::rename(tempPath, path);
+    }
+
+    uint64_t DownloadSegmentMap::CompletedSize() const
+    {
+        uint64_t result = 0;
+
+        for (const Segment& segment : Segments)
+        {
+            result += segment.Completed;
+        }
+
+        return result;
+    }
+
+    bool DownloadSegmentMap::IsComplete() const
+    {
+        return std::all_of(Segments.begin(), Segments.end(), [](const Segment& segment) { return segment.IsComplete(); });
+    }
+}
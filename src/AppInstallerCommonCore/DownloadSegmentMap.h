@@ -0,0 +1,57 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace AppInstaller::Utility
+{
+    // Tracks the progress of a download that is split into byte ranges, so that an interrupted download can be resumed.
+    // The map is persisted next to the file being downloaded, and is only valid for the same content and size.
+    struct DownloadSegmentMap
+    {
+        // A byte range of the content.
+        struct Segment
+        {
+            uint64_t Offset = 0;
+            uint64_t Size = 0;
+
+            // The number of bytes from the start of the segment that have been written to the file.
+            uint64_t Completed = 0;
+
+            bool IsComplete() const { return Completed >= Size; }
+        };
+
+        DownloadSegmentMap() = default;
+
+        // Splits content of the given size into segments of at most segmentSize bytes.
+        DownloadSegmentMap(std::string validator, uint64_t contentSize, uint64_t segmentSize);
+
+        // Gets the path of the map for the given download target.
+        static std::filesystem::path GetPathFor(const std::filesystem::path& target);
+
+        // Loads the map from the path.
+        // Returns an empty value if there is no map, it cannot be read, or it is for other content.
+        static std::optional<DownloadSegmentMap> Load(const std::filesystem::path& path, std::string_view validator, uint64_t contentSize);
+
+        // Saves the map to the path, replacing any existing map atomically.
+        void Save(const std::filesystem::path& path) const;
+
+        // Gets the number of bytes of the content that have been written to the file.
+        uint64_t CompletedSize() const;
+
+        // Determines if all segments are complete.
+        bool IsComplete() const;
+
+        // Identifies the content; the ETag or Last-Modified header of the response.
+        std::string Validator;
+
+        uint64_t ContentSize = 0;
+
+        std::vector<Segment> Segments;
+    };
+}
@@ -13,8 +13,12 @@
 #include "Public/winget/NetworkSettings.h"
 #include "Public/winget/Filesystem.h"
 #include "DODownloader.h"
+#include "DownloadSegmentMap.h"
 #include "HttpStream/HttpRandomAccessStream.h"
 #include "Public/winget/ThreadGlobals.h"
+#include <winget/Timing.h>
+
+#include <atomic>
 
 using namespace AppInstaller::Runtime;
 using namespace AppInstaller::Settings;
@@ -101,6 +105,111 @@ namespace AppInstaller::Utility
             std::wstring retryAfter = GetHttpQueryString(urlFile, HTTP_QUERY_RETRY_AFTER);
             return retryAfter.empty() ? 0s : AppInstaller::Utility::GetRetryAfter(retryAfter);
         }
+
+        wil::unique_hinternet OpenInternetSession()
+        {
+            auto agentWide = Utility::ConvertToUTF16(Runtime::GetDefaultUserAgent().get());
+            wil::unique_hinternet session;
+
+            const auto& proxyUri = Network().GetProxyUri();
+            if (proxyUri)
+            {
+                AICLI_LOG(Core, Info, << "Using proxy " << proxyUri.value());
+                session.reset(InternetOpen(
+                    agentWide.c_str(),
+                    INTERNET_OPEN_TYPE_PROXY,
+                    Utility::ConvertToUTF16(proxyUri.value()).c_str(),
+                    NULL,
+                    0));
+            }
+            else
+            {
+                session.reset(InternetOpen(
+                    agentWide.c_str(),
+                    INTERNET_OPEN_TYPE_PRECONFIG,
+                    NULL,
+                    NULL,
+                    0));
+            }
+
+            THROW_LAST_ERROR_IF_NULL_MSG(session, "InternetOpen() failed.");
+            return session;
+        }
+
+        // Opens the url with the request headers from the download info, followed by any additional headers.
+        wil::unique_hinternet OpenInternetUrl(const wil::unique_hinternet& session, const std::string& url, const std::optional<DownloadInfo>& info, std::string_view additionalHeaders = {})
+        {
+            std::string customHeaders;
+            if (info && info->RequestHeaders.size() > 0)
+            {
+                for (const auto& header : info->RequestHeaders)
+                {
+                    customHeaders += header.Name + ": " + header.Value + "\r\n";
+                }
+            }
+            customHeaders += additionalHeaders;
+            std::wstring customHeadersWide = Utility::ConvertToUTF16(customHeaders);
+
+            auto urlWide = Utility::ConvertToUTF16(url);
+            wil::unique_hinternet urlFile(InternetOpenUrl(
+                session.get(),
+                urlWide.c_str(),
+                customHeadersWide.empty() ? NULL : customHeadersWide.c_str(),
+                customHeadersWide.empty() ? 0 : (DWORD)(customHeadersWide.size()),
+                INTERNET_FLAG_IGNORE_REDIRECT_TO_HTTPS, // This allows http->https redirection
+                0));
+            THROW_LAST_ERROR_IF_NULL_MSG(urlFile, "InternetOpenUrl() failed.");
+
+            return urlFile;
+        }
+
+        DWORD GetHttpStatusCode(const wil::unique_hinternet& urlFile)
+        {
+            DWORD requestStatus = 0;
+            DWORD cbRequestStatus = sizeof(requestStatus);
+
+            THROW_LAST_ERROR_IF_MSG(!HttpQueryInfoW(urlFile.get(),
+                HTTP_QUERY_STATUS_CODE | HTTP_QUERY_FLAG_NUMBER,
+                &requestStatus,
+                &cbRequestStatus,
+                nullptr), "Query download request status failed.");
+
+            return requestStatus;
+        }
+
+        // Throws the appropriate exception for an unexpected http status.
+        [[noreturn]] void ThrowForHttpStatus(const wil::unique_hinternet& urlFile, DWORD requestStatus)
+        {
+            constexpr DWORD TooManyRequest = 429;
+
+            switch (requestStatus)
+            {
+            case TooManyRequest:
+            case HTTP_STATUS_SERVICE_UNAVAIL:
+            {
+                THROW_EXCEPTION(ServiceUnavailableException(GetRetryAfter(urlFile)));
+            }
+            default:
+                AICLI_LOG(Core, Error, << "Download request failed. Returned status: " << requestStatus);
+                THROW_HR_MSG(MAKE_HRESULT(SEVERITY_ERROR, FACILITY_HTTP, requestStatus), "Download request status is not success.");
+            }
+        }
+
+        // Gets the content length of the response, or 0 if it is not available.
+        LONGLONG GetContentLength(const wil::unique_hinternet& urlFile)
+        {
+            LONGLONG contentLength = 0;
+            DWORD cbContentLength = sizeof(contentLength);
+
+            HttpQueryInfoW(
+                urlFile.get(),
+                HTTP_QUERY_CONTENT_LENGTH | HTTP_QUERY_FLAG_NUMBER64,
+                &contentLength,
+                &cbContentLength,
+                nullptr);
+
+            return contentLength;
+        }
     }
 
 #ifndef AICLI_DISABLE_TEST_HOOKS
@@ -137,91 +246,19 @@ namespace AppInstaller::Utility
 
         AICLI_LOG(Core, Info, << "WinINet downloading from url: " << url);
 
-        auto agentWide = Utility::ConvertToUTF16(Runtime::GetDefaultUserAgent().get());
-        wil::unique_hinternet session;
-
-        const auto& proxyUri = Network().GetProxyUri();
-        if (proxyUri)
-        {
-            AICLI_LOG(Core, Info, << "Using proxy " << proxyUri.value());
-            session.reset(InternetOpen(
-                agentWide.c_str(),
-                INTERNET_OPEN_TYPE_PROXY,
-                Utility::ConvertToUTF16(proxyUri.value()).c_str(),
-                NULL,
-                0));
-        }
-        else
-        {
-            session.reset(InternetOpen(
-                agentWide.c_str(),
-                INTERNET_OPEN_TYPE_PRECONFIG,
-                NULL,
-                NULL,
-                0));
-        }
-
-        THROW_LAST_ERROR_IF_NULL_MSG(session, "InternetOpen() failed.");
-
-        std::string customHeaders;
-        if (info && info->RequestHeaders.size() > 0)
-        {
-            for (const auto& header : info->RequestHeaders)
-            {
-                customHeaders += header.Name + ": " + header.Value + "\r\n";
-            }
-        }
-        std::wstring customHeadersWide = Utility::ConvertToUTF16(customHeaders);
-
-        auto urlWide = Utility::ConvertToUTF16(url);
-        wil::unique_hinternet urlFile(InternetOpenUrl(
-            session.get(),
-            urlWide.c_str(),
-            customHeadersWide.empty() ? NULL : customHeadersWide.c_str(),
-            customHeadersWide.empty() ? 0 : (DWORD)(customHeadersWide.size()),
-            INTERNET_FLAG_IGNORE_REDIRECT_TO_HTTPS, // This allows http->https redirection
-            0));
-        THROW_LAST_ERROR_IF_NULL_MSG(urlFile, "InternetOpenUrl() failed.");
-
-        // Check http return status
-        DWORD requestStatus = 0;
-        DWORD cbRequestStatus = sizeof(requestStatus);
+        wil::unique_hinternet session = OpenInternetSession();
+        wil::unique_hinternet urlFile = OpenInternetUrl(session, url, info);
 
-        THROW_LAST_ERROR_IF_MSG(!HttpQueryInfoW(urlFile.get(),
-            HTTP_QUERY_STATUS_CODE | HTTP_QUERY_FLAG_NUMBER,
-            &requestStatus,
-            &cbRequestStatus,
-            nullptr), "Query download request status failed.");
-
-        constexpr DWORD TooManyRequest = 429;
-
-        switch (requestStatus)
-        {
-        case HTTP_STATUS_OK:
-            // All good
-            break;
-        case TooManyRequest:
-        case HTTP_STATUS_SERVICE_UNAVAIL:
+        DWORD requestStatus = GetHttpStatusCode(urlFile);
+        if (requestStatus != HTTP_STATUS_OK)
         {
-            THROW_EXCEPTION(ServiceUnavailableException(GetRetryAfter(urlFile)));
-        }
-        default:
-            AICLI_LOG(Core, Error, << "Download request failed. Returned status: " << requestStatus);
-            THROW_HR_MSG(MAKE_HRESULT(SEVERITY_ERROR, FACILITY_HTTP, requestStatus), "Download request status is not success.");
+            ThrowForHttpStatus(urlFile, requestStatus);
         }
 
         AICLI_LOG(Core, Verbose, << "Download request status success.");
 
         // Get content length. Don't fail the download if failed.
-        LONGLONG contentLength = 0;
-        DWORD cbContentLength = sizeof(contentLength);
-
-        HttpQueryInfoW(
-            urlFile.get(),
-            HTTP_QUERY_CONTENT_LENGTH | HTTP_QUERY_FLAG_NUMBER64,
-            &contentLength,
-            &cbContentLength,
-            nullptr);
+        LONGLONG contentLength = GetContentLength(urlFile);
         AICLI_LOG(Core, Verbose, << "Download size: " << contentLength);
 
         std::string contentType = Utility::ConvertToUTF8(GetHttpQueryString(urlFile, HTTP_QUERY_CONTENT_TYPE));
@@ -283,6 +320,391 @@ namespace AppInstaller::Utility
         return result;
     }
 
+    namespace
+    {
+        // A stream buffer that writes directly to a file handle, so the download can keep the handle it wrote through.
+        struct FileHandleStreamBuffer : public std::streambuf
+        {
+            FileHandleStreamBuffer(HANDLE file) : m_file(file) {}
+
+        protected:
+            std::streamsize xsputn(const char* data, std::streamsize count) override
+            {
+                Filesystem::WriteStringToFile(m_file, { data, static_cast<size_t>(count) });
+                return count;
+            }
+
+            int_type overflow(int_type c) override
+            {
+                if (!traits_type::eq_int_type(c, traits_type::eof()))
+                {
+                    char value = traits_type::to_char_type(c);
+                    Filesystem::WriteStringToFile(m_file, { &value, 1 });
+                }
+
+                return traits_type::not_eof(c);
+            }
+
+        private:
+            HANDLE m_file;
+        };
+
+        // Downloads at least this large are split into segments when the server supports range requests.
+        constexpr uint64_t s_SegmentedDownloadMinimumSize = 64 * 1024 * 1024; // 64MB
+        constexpr uint64_t s_DownloadSegmentSize = 16 * 1024 * 1024; // 16MB
+        constexpr size_t s_MaximumSegmentConnections = 4;
+
+        // The map is saved after this many buffers have been written, to bound the work lost to an interruption.
+        constexpr size_t s_BuffersPerSegmentMapSave = 16;
+
+        // What is learned about the content from a range request for its first byte.
+        struct SegmentedDownloadProbe
+        {
+            uint64_t ContentSize = 0;
+            std::string Validator;
+            std::string ContentType;
+        };
+
+        // Gets the total size from a Content-Range header value of the form "bytes 0-0/12345".
+        std::optional<uint64_t> GetContentRangeTotal(std::string_view contentRange)
+        {
+            size_t slash = contentRange.rfind('/');
+            if (slash == std::string_view::npos || slash + 1 == contentRange.size())
+            {
+                return std::nullopt;
+            }
+
+            try
+            {
+                return std::stoull(std::string{ contentRange.substr(slash + 1) });
+            }
+            catch (...)
+            {
+                return std::nullopt;
+            }
+        }
+
+        // Requests the first byte of the content to determine whether the server supports range requests.
+        std::optional<SegmentedDownloadProbe> ProbeForSegmentedDownload(const wil::unique_hinternet& session, const std::string& url, const std::optional<DownloadInfo>& info)
+        {
+            wil::unique_hinternet urlFile = OpenInternetUrl(session, url, info, "Range: bytes=0-0\r\n");
+
+            DWORD requestStatus = GetHttpStatusCode(urlFile);
+            if (requestStatus == HTTP_STATUS_OK)
+            {
+                AICLI_LOG(Core, Verbose, << "Server does not support range requests");
+                return std::nullopt;
+            }
+            else if (requestStatus != HTTP_STATUS_PARTIAL_CONTENT)
+            {
+                ThrowForHttpStatus(urlFile, requestStatus);
+            }
+
+            std::optional<uint64_t> contentSize = GetContentRangeTotal(Utility::ConvertToUTF8(GetHttpQueryString(urlFile, HTTP_QUERY_CONTENT_RANGE)));
+            if (!contentSize)
+            {
+                return std::nullopt;
+            }
+
+            SegmentedDownloadProbe result;
+            result.ContentSize = contentSize.value();
+            result.ContentType = Utility::ConvertToUTF8(GetHttpQueryString(urlFile, HTTP_QUERY_CONTENT_TYPE));
+
+            // Weak entity tags cannot be used to resume with If-Range, so fall back to the modified time.
+            result.Validator = Utility::ConvertToUTF8(GetHttpQueryString(urlFile, HTTP_QUERY_ETAG));
+            if (result.Validator.empty() || CaseInsensitiveStartsWith(result.Validator, "W/"))
+            {
+                result.Validator = Utility::ConvertToUTF8(GetHttpQueryString(urlFile, HTTP_QUERY_LAST_MODIFIED));
+            }
+
+            return result;
+        }
+
+        // The state shared by the connections of a segmented download.
+        struct SegmentedDownload
+        {
+            SegmentedDownload(const std::string& url, const std::optional<DownloadInfo>& info, DownloadSegmentMap map, std::filesystem::path mapPath, HANDLE file, IProgressCallback& progress) :
+                m_url(url), m_info(info), m_map(std::move(map)), m_mapPath(std::move(mapPath)), m_file(file), m_progress(progress)
+            {
+                m_completedSize = m_map.CompletedSize();
+            }
+
+            // Downloads segments until there are none left, or the download has failed or been cancelled.
+            void RunConnection(const wil::unique_hinternet& session)
+            {
+                auto buffer = std::make_unique<BYTE[]>(s_BufferSize);
+
+                try
+                {
+                    for (std::optional<size_t> segment = TakeNextSegment(); segment; segment = TakeNextSegment())
+                    {
+                        DownloadSegment(session, segment.value(), buffer.get());
+                    }
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock{ m_lock };
+                    if (!m_failure)
+                    {
+                        m_failure = std::current_exception();
+                    }
+                }
+            }
+
+            // Saves the map if the content can be identified on a later attempt.
+            void SaveMap()
+            {
+                if (m_map.Validator.empty())
+                {
+                    return;
+                }
+
+                try
+                {
+                    m_map.Save(m_mapPath);
+                }
+                CATCH_LOG_MSG("Failed to save download segment map");
+            }
+
+            bool IsCancelled() const { return m_cancelled; }
+
+            const std::exception_ptr& Failure() const { return m_failure; }
+
+        private:
+            static constexpr DWORD s_BufferSize = 1024 * 1024; // 1MB
+
+            std::optional<size_t> TakeNextSegment()
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+
+                if (m_failure || m_cancelled)
+                {
+                    return std::nullopt;
+                }
+
+                while (m_nextSegment < m_map.Segments.size() && m_map.Segments[m_nextSegment].IsComplete())
+                {
+                    ++m_nextSegment;
+                }
+
+                if (m_nextSegment == m_map.Segments.size())
+                {
+                    return std::nullopt;
+                }
+
+                return m_nextSegment++;
+            }
+
+            void DownloadSegment(const wil::unique_hinternet& session, size_t index, BYTE* buffer)
+            {
+                uint64_t position = 0;
+                uint64_t end = 0;
+
+                {
+                    std::lock_guard<std::mutex> lock{ m_lock };
+                    const auto& segment = m_map.Segments[index];
+                    position = segment.Offset + segment.Completed;
+                    end = segment.Offset + segment.Size;
+                }
+
+                // If-Range makes the server send the whole content instead should it have changed since the map was created.
+                std::string headers = "Range: bytes=" + std::to_string(position) + '-' + std::to_string(end - 1) + "\r\n";
+                if (!m_map.Validator.empty())
+                {
+                    headers += "If-Range: " + m_map.Validator + "\r\n";
+                }
+
+                wil::unique_hinternet urlFile = OpenInternetUrl(session, m_url, m_info, headers);
+
+                DWORD requestStatus = GetHttpStatusCode(urlFile);
+                if (requestStatus == HTTP_STATUS_OK)
+                {
+                    AICLI_LOG(Core, Error, << "Content changed during segmented download");
+                    THROW_HR(E_CHANGED_STATE);
+                }
+                else if (requestStatus != HTTP_STATUS_PARTIAL_CONTENT)
+                {
+                    ThrowForHttpStatus(urlFile, requestStatus);
+                }
+
+                while (position < end)
+                {
+                    if (m_progress.IsCancelledBy(CancelReason::Any))
+                    {
+                        m_cancelled = true;
+                        return;
+                    }
+
+                    DWORD bytesRead = 0;
+                    THROW_LAST_ERROR_IF_MSG(!InternetReadFile(urlFile.get(), buffer, s_BufferSize, &bytesRead), "InternetReadFile() failed.");
+                    THROW_HR_IF(APPINSTALLER_CLI_ERROR_DOWNLOAD_SIZE_MISMATCH, bytesRead == 0 || bytesRead > end - position);
+
+                    // The handle is synchronous, so the write is complete when WriteFile returns.
+                    OVERLAPPED overlapped{};
+                    overlapped.Offset = static_cast<DWORD>(position);
+                    overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+
+                    DWORD bytesWritten = 0;
+                    THROW_LAST_ERROR_IF(!WriteFile(m_file, buffer, bytesRead, &bytesWritten, &overlapped));
+                    THROW_HR_IF(E_UNEXPECTED, bytesWritten != bytesRead);
+
+                    position += bytesRead;
+                    OnWritten(index, bytesRead);
+                }
+            }
+
+            void OnWritten(size_t index, DWORD bytesWritten)
+            {
+                std::lock_guard<std::mutex> lock{ m_lock };
+
+                m_map.Segments[index].Completed += bytesWritten;
+                m_completedSize += bytesWritten;
+                m_progress.OnProgress(m_completedSize, m_map.ContentSize, ProgressType::Bytes);
+
+                if (++m_buffersSinceMapSave == s_BuffersPerSegmentMapSave)
+                {
+                    m_buffersSinceMapSave = 0;
+                    SaveMap();
+                }
+            }
+
+            const std::string& m_url;
+            const std::optional<DownloadInfo>& m_info;
+            DownloadSegmentMap m_map;
+            std::filesystem::path m_mapPath;
+            HANDLE m_file;
+            IProgressCallback& m_progress;
+
+            std::mutex m_lock;
+            size_t m_nextSegment = 0;
+            uint64_t m_completedSize = 0;
+            size_t m_buffersSinceMapSave = 0;
+            std::exception_ptr m_failure;
+            std::atomic_bool m_cancelled = false;
+        };
+    }
+
+    std::optional<DownloadResult> WinINetSegmentedDownload(
+        const std::string& url,
+        const std::filesystem::path& dest,
+        IProgressCallback& progress,
+        const std::optional<DownloadInfo>& info)
+    {
+        wil::unique_hinternet session = OpenInternetSession();
+
+        std::optional<SegmentedDownloadProbe> probe;
+        try
+        {
+            probe = ProbeForSegmentedDownload(session, url, info);
+        }
+        catch (...)
+        {
+            // Leave any failure to be reported by the regular download.
+            LOG_CAUGHT_EXCEPTION_MSG("Range request for segmented download failed");
+            return std::nullopt;
+        }
+
+        if (!probe || probe->ContentSize < s_SegmentedDownloadMinimumSize)
+        {
+            return std::nullopt;
+        }
+
+        AICLI_LOG(Core, Info, << "WinINet segmented download from url: " << url);
+        AICLI_LOG(Core, Verbose, << "Download size: " << probe->ContentSize);
+
+        std::filesystem::path mapPath = DownloadSegmentMap::GetPathFor(dest);
+        std::optional<DownloadSegmentMap> map;
+
+        if (std::filesystem::exists(dest) && std::filesystem::file_size(dest) == probe->ContentSize)
+        {
+            map = DownloadSegmentMap::Load(mapPath, probe->Validator, probe->ContentSize);
+        }
+
+        bool resuming = map.has_value();
+        if (resuming)
+        {
+            AICLI_LOG(Core, Info, << "Resuming download with " << map->CompletedSize() << " bytes already downloaded");
+        }
+        else
+        {
+            map = DownloadSegmentMap{ probe->Validator, probe->ContentSize, s_DownloadSegmentSize };
+
+            std::ofstream emptyDestFile(dest);
+            emptyDestFile.close();
+            ApplyMotwIfApplicable(dest, URLZONE_INTERNET);
+        }
+
+        // The handle is also used to hash the finished file, and keeps others from writing to it until then.
+        wil::unique_hfile file{ CreateFileW(dest.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+        THROW_LAST_ERROR_IF(!file);
+
+        if (!resuming)
+        {
+            // Allocate the whole file up front so that the segments can be written in any order.
+            FILE_END_OF_FILE_INFO endOfFile{};
+            endOfFile.EndOfFile.QuadPart = static_cast<LONGLONG>(probe->ContentSize);
+            THROW_IF_WIN32_BOOL_FALSE(SetFileInformationByHandle(file.get(), FileEndOfFileInfo, &endOfFile, sizeof(endOfFile)));
+        }
+
+        size_t remainingSegments = static_cast<size_t>(std::count_if(map->Segments.begin(), map->Segments.end(), [](const auto& segment) { return !segment.IsComplete(); }));
+        size_t connectionCount = std::max<size_t>(1, std::min(s_MaximumSegmentConnections, remainingSegments));
+
+        SegmentedDownload download{ url, info, std::move(map).value(), mapPath, file.get(), progress };
+        download.SaveMap();
+
+        ThreadLocalStorage::ThreadGlobals* threadGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+        std::vector<std::future<void>> otherConnections;
+
+        for (size_t i = 1; i < connectionCount; ++i)
+        {
+            otherConnections.emplace_back(std::async(std::launch::async, [&]()
+                {
+                    auto threadGlobalsCleanup = threadGlobals ? threadGlobals->SetForCurrentThread() : nullptr;
+                    download.RunConnection(session);
+                }));
+        }
+
+        download.RunConnection(session);
+
+        for (auto& connection : otherConnections)
+        {
+            connection.get();
+        }
+
+        if (download.Failure())
+        {
+            download.SaveMap();
+            std::rethrow_exception(download.Failure());
+        }
+
+        if (download.IsCancelled())
+        {
+            download.SaveMap();
+            AICLI_LOG(Core, Info, << "Download cancelled.");
+            return DownloadResult{};
+        }
+
+        // The segments may have been written in any order, so the hash is computed over the finished file.
+        // It is read back through the handle that wrote it, so the identity is that of the hashed contents.
+        LARGE_INTEGER fileStart{};
+        THROW_IF_WIN32_BOOL_FALSE(SetFilePointerEx(file.get(), fileStart, nullptr, FILE_BEGIN));
+
+        DownloadResult result;
+        result.SizeInBytes = probe->ContentSize;
+        result.ContentType = std::move(probe->ContentType);
+        result.Sha256Hash = SHA256::ComputeHashFromHandle(file.get());
+        result.FileIdentity = Filesystem::GetWrittenFileIdentity(file.get());
+        file.reset();
+        AICLI_LOG(Core, Info, << "Download hash: " << SHA256::ConvertToString(result.Sha256Hash));
+
+        std::error_code error;
+        std::filesystem::remove(mapPath, error);
+
+        AICLI_LOG(Core, Info, << "Download completed.");
+
+        return result;
+    }
+
     std::map<std::string, std::string> GetHeaders(std::string_view url)
     {
         // TODO: Use proxy info. HttpClient does not support using a custom proxy, only using the system-wide one.
@@ -353,6 +775,7 @@ namespace AppInstaller::Utility
         THROW_HR_IF(E_INVALIDARG, url.empty());
         THROW_HR_IF(E_INVALIDARG, dest.empty());
 
+        Timing::ScopedTimer timer{ Timing::Phase::Download };
         AICLI_LOG(Core, Info, << "Downloading to path: " << dest);
 
         std::filesystem::create_directories(dest.parent_path());
@@ -367,14 +790,8 @@ namespace AppInstaller::Utility
             {
                 try
                 {
-                    auto result = DODownload(url, dest, progress, info);
-                    // Since we cannot pre-apply to the file with DO, post-apply the MotW to the file.
-                    // Only do so if the file exists, because cancellation will not throw here.
-                    if (std::filesystem::exists(dest))
-                    {
-                        ApplyMotwIfApplicable(dest, URLZONE_INTERNET);
-                    }
-                    return result;
+                    // DO applies the MotW to the file itself, as it must do so before hashing it.
+                    return DODownload(url, dest, progress, info);
                 }
                 catch (const wil::ResultException& re)
                 {
@@ -402,14 +819,38 @@ namespace AppInstaller::Utility
             }
         }
 
+        // Large installers are downloaded in parallel segments if the server allows it.
+        if (type == DownloadType::Installer)
+        {
+            std::optional<DownloadResult> segmentedResult = WinINetSegmentedDownload(url, dest, progress, info);
+            if (segmentedResult)
+            {
+                return std::move(segmentedResult).value();
+            }
+        }
+
         std::ofstream emptyDestFile(dest);
         emptyDestFile.close();
         ApplyMotwIfApplicable(dest, URLZONE_INTERNET);
 
-        // Use std::ofstream::app to append to previous empty file so that it will not
-        // create a new file and clear motw.
-        std::ofstream outfile(dest, std::ofstream::binary | std::ofstream::app);
-        return WinINetDownloadToStream(url, outfile, progress, info);
+        // Open the existing empty file so that it will not create a new file and clear motw.
+        // The handle keeps others from writing to the file, so the identity captured before it is closed is that of the hashed contents.
+        wil::unique_hfile file{ CreateFileW(dest.c_str(), GENERIC_WRITE | FILE_READ_ATTRIBUTES, FILE_SHARE_READ, nullptr, TRUNCATE_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+        THROW_LAST_ERROR_IF(!file);
+
+        FileHandleStreamBuffer fileBuffer{ file.get() };
+        std::ostream outfile{ &fileBuffer };
+        outfile.exceptions(std::ios_base::badbit);
+
+        DownloadResult result = WinINetDownloadToStream(url, outfile, progress, info);
+
+        // A cancelled download has no hash, so it has no identity either.
+        if (!result.Sha256Hash.empty())
+        {
+            result.FileIdentity = Filesystem::GetWrittenFileIdentity(file.get());
+        }
+
+        return result;
     }
 
     using namespace std::string_view_literals;
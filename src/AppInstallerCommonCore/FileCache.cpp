@@ -5,6 +5,8 @@
 #include <AppInstallerDownloader.h>
 #include <AppInstallerLogging.h>
 #include <AppInstallerStrings.h>
+#include <AppInstallerSynchronization.h>
+#include <winget/Filesystem.h>
 
 namespace AppInstaller::Caching
 {
@@ -26,7 +28,291 @@ namespace AppInstaller::Caching
             THROW_HR(E_UNEXPECTED);
         }
 
-        std::unique_ptr<std::stringstream> GetUpstreamFile(const std::string& basePath, const std::string& relativePath, const Utility::SHA256::HashBuffer& expectedHash)
+        // Derived contents cannot be verified against the hash of the file they came from, so they are kept in a directory
+        // that only the current user (and the system and administrators) can write to, shared by the processes of that user.
+        // Each item is the hash of the file the contents were derived from, followed by the contents.
+        struct DerivedContentsStore
+        {
+            static DerivedContentsStore& Instance()
+            {
+                // Intentionally leaked so that it is shared by every cache for the lifetime of the process.
+                static DerivedContentsStore* s_instance = new DerivedContentsStore();
+                return *s_instance;
+            }
+
+            std::optional<std::string> Get(const std::wstring& key, const Utility::SHA256::HashBuffer& expectedHash) const
+            {
+                if (m_directory.empty())
+                {
+                    return std::nullopt;
+                }
+
+                std::filesystem::path itemPath = GetItemPath(key);
+                std::ifstream stream{ itemPath, std::ios_base::in | std::ios_base::binary };
+                if (!stream)
+                {
+                    return std::nullopt;
+                }
+
+                auto itemSize = std::filesystem::file_size(itemPath);
+                Utility::SHA256::HashBuffer sourceHash(s_HashSize);
+                stream.read(reinterpret_cast<char*>(sourceHash.data()), static_cast<std::streamsize>(sourceHash.size()));
+
+                if (itemSize < s_HashSize || itemSize - s_HashSize > s_MaximumTotalSize || !stream ||
+                    !Utility::SHA256::AreEqual(sourceHash, expectedHash))
+                {
+                    // The source file has changed (or the item is not whole), so the item will not be used again.
+                    stream.close();
+                    std::error_code error;
+                    std::filesystem::remove(itemPath, error);
+                    return std::nullopt;
+                }
+
+                std::string result(static_cast<size_t>(itemSize - s_HashSize), '\0');
+                stream.read(result.data(), static_cast<std::streamsize>(result.size()));
+                THROW_HR_IF(E_UNEXPECTED, static_cast<size_t>(stream.gcount()) != result.size());
+
+                return result;
+            }
+
+            void Store(const std::wstring& key, const Utility::SHA256::HashBuffer& sourceHash, std::string_view contents) const
+            {
+                if (m_directory.empty() || contents.size() > s_MaximumTotalSize || sourceHash.size() != s_HashSize)
+                {
+                    return;
+                }
+
+                // If another process is writing this item, it is deriving it from the same source.
+                std::string itemName = GetItemName(key);
+                Synchronization::CrossProcessLock lock{ "WinGetDerivedContents_" + itemName };
+                if (!lock.TryAcquireNoWait())
+                {
+                    return;
+                }
+
+                // Write to the side and move into place so that readers never see a partial item.
+                std::filesystem::path itemPath = m_directory / Utility::ConvertToUTF16(itemName);
+                std::filesystem::path tempPath = itemPath;
+                tempPath += ".tmp";
+
+                {
+                    std::ofstream stream{ tempPath, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary };
+                    stream.write(reinterpret_cast<const char*>(sourceHash.data()), static_cast<std::streamsize>(sourceHash.size()));
+                    stream.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+                    stream.flush();
+                    THROW_HR_IF(E_UNEXPECTED, stream.fail());
+                }
+
+                std::filesystem::rename(tempPath, itemPath);
+
+                lock.Release();
+                Evict();
+            }
+
+        private:
+            // The total size of the stored items after which the least recently written are evicted.
+            static constexpr uint64_t s_MaximumTotalSize = 64 * 1024 * 1024;
+
+            // Items that have not been written for this long are evicted, regardless of the total size.
+            static constexpr std::chrono::hours s_MaximumItemAge{ 7 * 24 };
+
+            static constexpr size_t s_HashSize = 32;
+
+            DerivedContentsStore()
+            {
+                try
+                {
+                    Filesystem::PathDetails details;
+                    details.Path = Runtime::GetPathTo(Runtime::PathName::Temp) / "cache" / "Derived";
+                    details.SetOwner(Filesystem::ACEPrincipal::CurrentUser);
+                    details.ACL[Filesystem::ACEPrincipal::System] = Filesystem::ACEPermissions::All;
+                    details.ACL[Filesystem::ACEPrincipal::Admins] = Filesystem::ACEPermissions::All;
+                    m_directory = Filesystem::InitializeAndGetPathTo(std::move(details));
+                }
+                catch (...)
+                {
+                    LOG_CAUGHT_EXCEPTION_MSG("Failed to secure the derived contents directory; derived contents will not be stored");
+                    m_directory.clear();
+                }
+            }
+
+            // The key contains the full path to the cached file, so it is hashed into a name of fixed length.
+            static std::string GetItemName(const std::wstring& key)
+            {
+                return Utility::SHA256::ConvertToString(Utility::SHA256::ComputeHash(Utility::ConvertToUTF8(key))) + ".bin";
+            }
+
+            std::filesystem::path GetItemPath(const std::wstring& key) const
+            {
+                return m_directory / Utility::ConvertToUTF16(GetItemName(key));
+            }
+
+            // Removes old items, then the least recently written items until the store is within its maximum size.
+            void Evict() const try
+            {
+                // Another process evicting will leave the store within the limits as well.
+                Synchronization::CrossProcessLock lock{ "WinGetDerivedContentsEviction" };
+                if (!lock.TryAcquireNoWait())
+                {
+                    return;
+                }
+
+                struct ItemFile
+                {
+                    std::filesystem::path Path;
+                    uint64_t Size = 0;
+                    std::filesystem::file_time_type LastWritten;
+                };
+
+                std::vector<ItemFile> itemFiles;
+                uint64_t totalSize = 0;
+                auto oldestAllowed = std::filesystem::file_time_type::clock::now() - s_MaximumItemAge;
+
+                for (const auto& directoryEntry : std::filesystem::directory_iterator{ m_directory })
+                {
+                    if (!directoryEntry.is_regular_file())
+                    {
+                        continue;
+                    }
+
+                    ItemFile itemFile;
+                    itemFile.Path = directoryEntry.path();
+                    itemFile.LastWritten = directoryEntry.last_write_time();
+
+                    // This also removes temporary files left behind by a failed write.
+                    if (itemFile.LastWritten < oldestAllowed)
+                    {
+                        std::error_code error;
+                        std::filesystem::remove(itemFile.Path, error);
+                        continue;
+                    }
+
+                    // Anything else is an item being written.
+                    if (itemFile.Path.extension() != L".bin")
+                    {
+                        continue;
+                    }
+
+                    itemFile.Size = directoryEntry.file_size();
+                    totalSize += itemFile.Size;
+                    itemFiles.emplace_back(std::move(itemFile));
+                }
+
+                if (totalSize <= s_MaximumTotalSize)
+                {
+                    return;
+                }
+
+                std::sort(itemFiles.begin(), itemFiles.end(), [](const ItemFile& a, const ItemFile& b) { return a.LastWritten < b.LastWritten; });
+
+                for (const ItemFile& itemFile : itemFiles)
+                {
+                    if (totalSize <= s_MaximumTotalSize)
+                    {
+                        break;
+                    }
+
+                    std::error_code error;
+                    if (std::filesystem::remove(itemFile.Path, error))
+                    {
+                        totalSize -= itemFile.Size;
+                    }
+                }
+            }
+            CATCH_LOG_MSG("DerivedContentsStore::Evict exception");
+
+            // Empty if the directory could not be restricted to the current user.
+            std::filesystem::path m_directory;
+        };
+
+        // A read-only stream buffer over a string that it owns, so that file contents can be handed out without copying them.
+        struct OwnedStringBuffer : public std::streambuf
+        {
+            OwnedStringBuffer(std::string contents) : m_contents(std::move(contents))
+            {
+                char* begin = m_contents.data();
+                setg(begin, begin, begin + m_contents.size());
+            }
+
+            std::string TakeContents()
+            {
+                setg(nullptr, nullptr, nullptr);
+                return std::move(m_contents);
+            }
+
+        protected:
+            pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override
+            {
+                if (!(which & std::ios_base::in))
+                {
+                    return pos_type(off_type(-1));
+                }
+
+                off_type base = 0;
+                switch (direction)
+                {
+                case std::ios_base::beg: base = 0; break;
+                case std::ios_base::cur: base = gptr() - eback(); break;
+                case std::ios_base::end: base = egptr() - eback(); break;
+                default: return pos_type(off_type(-1));
+                }
+
+                off_type target = base + offset;
+                if (target < 0 || target > egptr() - eback())
+                {
+                    return pos_type(off_type(-1));
+                }
+
+                setg(eback(), eback() + target, egptr());
+                return pos_type(target);
+            }
+
+            pos_type seekpos(pos_type position, std::ios_base::openmode which) override
+            {
+                return seekoff(off_type(position), std::ios_base::beg, which);
+            }
+
+        private:
+            std::string m_contents;
+        };
+
+        // An input stream that owns the contents it reads from.
+        struct OwnedStringStream : public std::istream
+        {
+            OwnedStringStream(std::string contents) : std::istream(nullptr), m_buffer(std::move(contents))
+            {
+                rdbuf(&m_buffer);
+            }
+
+            // Moves the contents out of the stream, which is left empty.
+            std::string TakeContents()
+            {
+                setstate(std::ios_base::eofbit);
+                return m_buffer.TakeContents();
+            }
+
+        private:
+            OwnedStringBuffer m_buffer;
+        };
+
+        // Reads the entire file with a single read into a buffer sized for it.
+        std::string ReadEntireFile(const std::filesystem::path& path)
+        {
+            std::ifstream fileStream{ path, std::ios_base::in | std::ios_base::binary };
+            THROW_LAST_ERROR_IF(fileStream.fail());
+
+            auto fileSize = std::filesystem::file_size(path);
+            // Don't allow use of this for reading very large files.
+            THROW_HR_IF(E_OUTOFMEMORY, fileSize > std::numeric_limits<uint32_t>::max());
+
+            std::string result(static_cast<size_t>(fileSize), '\0');
+            fileStream.read(result.data(), static_cast<std::streamsize>(result.size()));
+            result.resize(static_cast<size_t>(fileStream.gcount()));
+
+            return result;
+        }
+
+        std::unique_ptr<std::istream> GetUpstreamFile(const std::string& basePath, const std::string& relativePath, const Utility::SHA256::HashBuffer& expectedHash)
         {
             // Until signed files are implemented, fail on an empty hash
             THROW_HR_IF(APPINSTALLER_CLI_ERROR_SOURCE_DATA_INTEGRITY_FAILURE, expectedHash.empty());
@@ -100,14 +386,13 @@ namespace AppInstaller::Caching
             else
             {
                 AICLI_LOG(Core, Verbose, << "Getting upstream file from local: " << fullPath);
-                std::ifstream fileStream{ fullPath, std::ios_base::in | std::ios_base::binary };
-                std::string fileContents = Utility::ReadEntireStream(fileStream);
+                std::string fileContents = ReadEntireFile(Utility::ConvertToUTF16(fullPath));
 
                 auto fileContentsHash = Utility::SHA256::ComputeHash(fileContents);
 
                 if (expectedHash.empty() || Utility::SHA256::AreEqual(expectedHash, fileContentsHash))
                 {
-                    return std::make_unique<std::stringstream>(std::move(fileContents));
+                    return std::make_unique<OwnedStringStream>(std::move(fileContents));
                 }
                 else
                 {
@@ -167,14 +452,14 @@ namespace AppInstaller::Caching
             {
                 AICLI_LOG(Core, Verbose, << "Reading cached file [" << cachedFilePath << "]");
 
-                std::ifstream fileStream{ cachedFilePath, std::ios_base::in | std::ios_base::binary };
-                std::string fileContents = Utility::ReadEntireStream(fileStream);
+                // Read once and hand out a stream over the same buffer that was hashed.
+                std::string fileContents = anon::ReadEntireFile(cachedFilePath);
 
                 auto fileContentsHash = Utility::SHA256::ComputeHash(fileContents);
 
                 if (Utility::SHA256::AreEqual(expectedHash, fileContentsHash))
                 {
-                    return std::make_unique<std::istringstream>(std::move(fileContents));
+                    return std::make_unique<anon::OwnedStringStream>(std::move(fileContents));
                 }
                 else
                 {
@@ -202,7 +487,7 @@ namespace AppInstaller::Caching
             AICLI_LOG(Core, Verbose, << "Writing cached file [" << cachedFilePath << "]");
             std::ofstream fileStream{ cachedFilePath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc };
             LOG_LAST_ERROR_IF(fileStream.fail());
-            fileStream << result->str() << std::flush;
+            fileStream << result->rdbuf() << std::flush;
             LOG_LAST_ERROR_IF(fileStream.fail());
         }
         catch (...)
@@ -210,10 +495,61 @@ namespace AppInstaller::Caching
             LOG_CAUGHT_EXCEPTION_MSG("Error while attempting to write cached file");
         }
 
+        // Writing the file out consumed the stream; rewind it for the caller.
+        result->clear();
+        result->seekg(0);
+
         return result;
     }
 
-    std::unique_ptr<std::stringstream> FileCache::GetUpstreamFile(std::string relativePath, const Utility::SHA256::HashBuffer& expectedHash) const
+    std::string FileCache::GetFileContents(const std::filesystem::path& relativePath, const Utility::SHA256::HashBuffer& expectedHash) const
+    {
+        auto stream = GetFile(relativePath, expectedHash);
+
+        // Cached files are already in memory; take them rather than copying them out of the stream.
+        if (auto ownedStream = dynamic_cast<anon::OwnedStringStream*>(stream.get()))
+        {
+            return ownedStream->TakeContents();
+        }
+
+        return Utility::ReadEntireStream(*stream);
+    }
+
+    std::optional<std::string> FileCache::GetDerivedContents(const std::filesystem::path& relativePath, const Utility::SHA256::HashBuffer& expectedHash, std::string_view derivedName) const
+    {
+        try
+        {
+            return anon::DerivedContentsStore::Instance().Get(GetDerivedContentsKey(relativePath, derivedName), expectedHash);
+        }
+        catch (...)
+        {
+            LOG_CAUGHT_EXCEPTION_MSG("Error while attempting to read derived contents");
+        }
+
+        return std::nullopt;
+    }
+
+    void FileCache::StoreDerivedContents(const std::filesystem::path& relativePath, const Utility::SHA256::HashBuffer& sourceHash, std::string_view derivedName, std::string_view contents) const
+    {
+        try
+        {
+            anon::DerivedContentsStore::Instance().Store(GetDerivedContentsKey(relativePath, derivedName), sourceHash, contents);
+        }
+        catch (...)
+        {
+            LOG_CAUGHT_EXCEPTION_MSG("Error while attempting to store derived contents");
+        }
+    }
+
+    std::wstring FileCache::GetDerivedContentsKey(const std::filesystem::path& relativePath, std::string_view derivedName) const
+    {
+        std::filesystem::path result = m_cacheBase / relativePath;
+        result += L'.';
+        result += Utility::ConvertToUTF16(derivedName);
+        return result.wstring();
+    }
+
+    std::unique_ptr<std::istream> FileCache::GetUpstreamFile(std::string relativePath, const Utility::SHA256::HashBuffer& expectedHash) const
     {
         // Replace backslashes with forward slashes for HTTP requests (since local can handle them).
         Utility::FindAndReplace(relativePath, "\\", "/");
@@ -9,6 +9,7 @@
 #include "Public/winget/UserSettings.h"
 #include <winget/Filesystem.h>
 #include <corecrt_io.h>
+#include <atomic>
 
 
 namespace AppInstaller::Logging
@@ -21,12 +22,92 @@ namespace AppInstaller::Logging
         static constexpr std::string_view s_fileLoggerDefaultFilePrefix = "WinGet"sv;
         static constexpr std::string_view s_fileLoggerDefaultFileExt = ".log"sv;
 
-        // Send to a string first to create a single block to write to a file.
+        // Do not keep the memory from an unusually large log.
+        static constexpr size_t s_maximumRetainedLogLineCapacity = 64 * 1024;
+
+        // Appends the value in decimal, padded with leading zeros to at least the given number of digits.
+        void AppendZeroPadded(std::string& out, unsigned int value, size_t digits)
+        {
+            char buffer[16];
+            size_t length = 0;
+
+            do
+            {
+                buffer[length++] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+
+            while (length < digits && length < ARRAYSIZE(buffer))
+            {
+                buffer[length++] = '0';
+            }
+
+            while (length > 0)
+            {
+                out.push_back(buffer[--length]);
+            }
+        }
+
+        // Appends the time in the same format as OutputTimePoint.
+        // Converting to local time is comparatively expensive, so the text up to the seconds is reused within the same second.
+        void AppendTime(std::string& out, const std::chrono::system_clock::time_point& time)
+        {
+            thread_local time_t t_cachedTime = -1;
+            thread_local std::string t_cachedText;
+
+            time_t tt = std::chrono::system_clock::to_time_t(time);
+            if (tt != t_cachedTime)
+            {
+                tm localTime{};
+                _localtime64_s(&localTime, &tt);
+
+                t_cachedText.clear();
+                AppendZeroPadded(t_cachedText, static_cast<unsigned int>(1900 + localTime.tm_year), 4);
+                t_cachedText.push_back('-');
+                AppendZeroPadded(t_cachedText, static_cast<unsigned int>(1 + localTime.tm_mon), 2);
+                t_cachedText.push_back('-');
+                AppendZeroPadded(t_cachedText, static_cast<unsigned int>(localTime.tm_mday), 2);
+                t_cachedText.push_back(' ');
+                AppendZeroPadded(t_cachedText, static_cast<unsigned int>(localTime.tm_hour), 2);
+                t_cachedText.push_back(':');
+                AppendZeroPadded(t_cachedText, static_cast<unsigned int>(localTime.tm_min), 2);
+                t_cachedText.push_back(':');
+                AppendZeroPadded(t_cachedText, static_cast<unsigned int>(localTime.tm_sec), 2);
+
+                t_cachedTime = tt;
+            }
+
+            auto sinceEpoch = time.time_since_epoch();
+            auto leftoverMillis = std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch) - std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch);
+
+            out.append(t_cachedText);
+            out.push_back('.');
+            AppendZeroPadded(out, static_cast<unsigned int>(leftoverMillis.count()), 3);
+        }
+
+        // Formats the log line into the given string, to create a single block to write to a file.
+        void AppendLogLine(std::string& out, Channel channel, Level level, std::string_view message)
+        {
+            std::string_view channelName = GetChannelName(channel);
+
+            AppendTime(out, std::chrono::system_clock::now());
+            out.append(" <");
+            out.push_back(GetLevelChar(level));
+            out.append("> [");
+            out.append(channelName);
+            if (channelName.size() < GetMaxChannelNameLength())
+            {
+                out.append(GetMaxChannelNameLength() - channelName.size(), ' ');
+            }
+            out.append("] ");
+            out.append(message);
+        }
+
         std::string ToLogLine(Channel channel, Level level, std::string_view message)
         {
-            std::stringstream strstr;
-            strstr << std::chrono::system_clock::now() << " <" << GetLevelChar(level) << "> [" << std::setw(GetMaxChannelNameLength()) << std::left << std::setfill(' ') << GetChannelName(channel) << "] " << message;
-            return std::move(strstr).str();
+            std::string result;
+            AppendLogLine(result, channel, level, message);
+            return result;
         }
 
         // Determines the difference between the given position and the maximum as an offset.
@@ -35,8 +116,147 @@ namespace AppInstaller::Logging
             auto offsetPosition = static_cast<std::ofstream::off_type>(position);
             return maximum > offsetPosition ? maximum - offsetPosition : 0;
         }
+
+        // Logs that should be on disk before anything else happens, as the process may be about to fail.
+        bool MustWriteImmediately(Channel channel, Level level)
+        {
+            return channel == Channel::Fail || ToIntegral(level) >= ToIntegral(Level::Error);
+        }
+
+        // A bounded queue of log lines that any number of threads can add to without taking a lock,
+        // and that one thread at a time removes from.
+        // Each cell has a sequence number; the cell for position P is free to add to when its sequence is P,
+        // and holds the line for position P when its sequence is P + 1.
+        struct LogLineQueue
+        {
+            // Must be a power of 2.
+            static constexpr size_t Capacity = 4096;
+
+            LogLineQueue() : m_cells(std::make_unique<Cell[]>(Capacity))
+            {
+                for (size_t i = 0; i < Capacity; ++i)
+                {
+                    m_cells[i].Sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            // Adds a copy of the line to the queue. Returns false if the queue is full.
+            // The cells keep their capacity, so this does not allocate once they have grown to fit the lines.
+            bool TryPush(std::string_view line)
+            {
+                size_t position = m_pushPosition.load(std::memory_order_relaxed);
+
+                for (;;)
+                {
+                    Cell& cell = m_cells[position & (Capacity - 1)];
+                    size_t sequence = cell.Sequence.load(std::memory_order_acquire);
+                    auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+                    if (difference == 0)
+                    {
+                        // Sequentially consistent so that it is ordered with the check for a waiting writer.
+                        if (m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                        {
+                            cell.Line.assign(line);
+                            cell.Sequence.store(position + 1, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (difference < 0)
+                    {
+                        // The cell still holds the line from the previous lap
+                        return false;
+                    }
+                    else
+                    {
+                        position = m_pushPosition.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            // Removes the oldest line from the queue into the given string. Returns false if the queue is empty.
+            // If another thread is in the middle of adding the line, waits for it so that lines are never skipped.
+            // Callers must ensure that only one thread removes lines at a time.
+            bool TryPop(std::string& line)
+            {
+                size_t position = m_popPosition.load(std::memory_order_relaxed);
+                if (position == m_pushPosition.load(std::memory_order_acquire))
+                {
+                    return false;
+                }
+
+                Cell& cell = m_cells[position & (Capacity - 1)];
+                while (cell.Sequence.load(std::memory_order_acquire) != position + 1)
+                {
+                    std::this_thread::yield();
+                }
+
+                // Swap so that both strings keep their capacity for reuse.
+                line.clear();
+                line.swap(cell.Line);
+                cell.Sequence.store(position + Capacity, std::memory_order_release);
+                m_popPosition.store(position + 1, std::memory_order_relaxed);
+                return true;
+            }
+
+            // Determines if there is a line to remove.
+            bool IsEmpty() const
+            {
+                return m_popPosition.load(std::memory_order_relaxed) == m_pushPosition.load();
+            }
+
+        private:
+            struct Cell
+            {
+                std::atomic<size_t> Sequence;
+                std::string Line;
+            };
+
+            std::unique_ptr<Cell[]> m_cells;
+            alignas(64) std::atomic<size_t> m_pushPosition = 0;
+            alignas(64) std::atomic<size_t> m_popPosition = 0;
+        };
+
+        // The file loggers in the process, so that they can all be flushed on shutdown.
+        struct FileLoggerRegistry
+        {
+            std::mutex Lock;
+            std::vector<FileLogger*> Loggers;
+        };
+
+        FileLoggerRegistry& GetFileLoggerRegistry()
+        {
+            // Never destroyed, as loggers owned by static objects are destroyed during static destruction.
+            static FileLoggerRegistry* s_registry = new FileLoggerRegistry{};
+            return *s_registry;
+        }
+
+        void RegisterFileLogger(FileLogger* logger)
+        {
+            auto& registry = GetFileLoggerRegistry();
+            std::lock_guard<std::mutex> lock{ registry.Lock };
+            registry.Loggers.emplace_back(logger);
+        }
+
+        void UnregisterFileLogger(FileLogger* logger)
+        {
+            auto& registry = GetFileLoggerRegistry();
+            std::lock_guard<std::mutex> lock{ registry.Lock };
+            registry.Loggers.erase(std::remove(registry.Loggers.begin(), registry.Loggers.end(), logger), registry.Loggers.end());
+        }
     }
 
+    struct FileLogger::BackgroundWriter
+    {
+        LogLineQueue Queue;
+        // The line being written; the stream lock must be held.
+        std::string CurrentLine;
+        wil::unique_event WorkAvailable{ wil::EventOptions::None };
+        std::atomic<bool> WriterWaiting = false;
+        std::atomic<bool> Stopping = false;
+        std::thread Thread;
+    };
+
     FileLogger::FileLogger() : FileLogger(s_fileLoggerDefaultFilePrefix) {}
 
     FileLogger::FileLogger(const std::filesystem::path& filePath)
@@ -45,6 +265,7 @@ namespace AppInstaller::Logging
         m_filePath = filePath;
         InitializeDefaultMaximumFileSize();
         OpenFileLoggerStream();
+        RegisterFileLogger(this);
     }
 
     FileLogger::FileLogger(const std::string_view fileNamePrefix)
@@ -54,10 +275,21 @@ namespace AppInstaller::Logging
         m_filePath /= fileNamePrefix.data() + ('-' + Utility::GetCurrentTimeForFilename() + s_fileLoggerDefaultFileExt.data());
         InitializeDefaultMaximumFileSize();
         OpenFileLoggerStream();
+        RegisterFileLogger(this);
     }
 
     FileLogger::~FileLogger()
     {
+        UnregisterFileLogger(this);
+
+        if (m_backgroundWriter)
+        {
+            m_backgroundWriter->Stopping = true;
+            m_backgroundWriter->WorkAvailable.SetEvent();
+            m_backgroundWriter->Thread.join();
+        }
+
+        WriteQueuedLines();
         m_stream.flush();
         // When std::ofstream is constructed from an existing File handle, it does not call fclose on destruction
         // Only calling close() explicitly will close the file handle.
@@ -71,6 +303,25 @@ namespace AppInstaller::Logging
         return *this;
     }
 
+    FileLogger& FileLogger::EnableBackgroundWriter()
+    {
+        if (!m_backgroundWriter)
+        {
+            m_backgroundWriter = std::make_unique<BackgroundWriter>();
+            m_backgroundWriter->Thread = std::thread(&FileLogger::BackgroundWriterThread, this);
+        }
+
+        return *this;
+    }
+
+    void FileLogger::Flush() noexcept try
+    {
+        std::lock_guard<std::mutex> lock{ m_streamLock };
+        WriteQueuedLines();
+        m_stream.flush();
+    }
+    catch (...) {}
+
     std::string FileLogger::GetNameForPath(const std::filesystem::path& filePath)
     {
         using namespace std::string_literals;
@@ -94,15 +345,43 @@ namespace AppInstaller::Logging
 
     void FileLogger::Write(Channel channel, Level level, std::string_view message) noexcept try
     {
-        std::string log = ToLogLine(channel, level, message);
+        // Reused by the thread to avoid allocating for every log.
+        thread_local std::string t_log;
+        if (t_log.capacity() > s_maximumRetainedLogLineCapacity)
+        {
+            t_log = std::string{};
+        }
+        t_log.clear();
+        AppendLogLine(t_log, channel, level, message);
+        std::string_view log = t_log;
+
+        if (m_backgroundWriter && !MustWriteImmediately(channel, level))
+        {
+            while (!m_backgroundWriter->Queue.TryPush(log))
+            {
+                // The writer has fallen behind; make room on this thread rather than wait for it.
+                std::lock_guard<std::mutex> lock{ m_streamLock };
+                WriteQueuedLines();
+            }
+
+            if (m_backgroundWriter->WriterWaiting.exchange(false))
+            {
+                m_backgroundWriter->WorkAvailable.SetEvent();
+            }
+
+            return;
+        }
+
         WriteDirect(channel, level, log);
     }
     catch (...) {}
 
     void FileLogger::WriteDirect(Channel, Level, std::string_view message) noexcept try
     {
-        HandleMaximumFileSize(message);
-        m_stream << message << std::endl;
+        std::lock_guard<std::mutex> lock{ m_streamLock };
+        WriteQueuedLines();
+        WriteLine(message);
+        m_stream.flush();
     }
     catch (...) {}
 
@@ -110,6 +389,9 @@ namespace AppInstaller::Logging
     {
         if (tag == Tag::HeadersComplete)
         {
+            std::lock_guard<std::mutex> lock{ m_streamLock };
+            WriteQueuedLines();
+
             auto currentPosition = m_stream.tellp();
             if (currentPosition != std::ofstream::pos_type{ -1 })
             {
@@ -134,6 +416,25 @@ namespace AppInstaller::Logging
         Log().AddLogger(std::make_unique<FileLogger>(fileNamePrefix));
     }
 
+    void FileLogger::AddWithBackgroundWriter(std::string_view fileNamePrefix)
+    {
+        auto logger = std::make_unique<FileLogger>(fileNamePrefix);
+        logger->EnableBackgroundWriter();
+        Log().AddLogger(std::move(logger));
+    }
+
+    void FileLogger::FlushAll() noexcept try
+    {
+        auto& registry = GetFileLoggerRegistry();
+        std::lock_guard<std::mutex> lock{ registry.Lock };
+
+        for (FileLogger* logger : registry.Loggers)
+        {
+            logger->Flush();
+        }
+    }
+    catch (...) {}
+
     void FileLogger::BeginCleanup()
     {
         BeginCleanup(Runtime::GetPathTo(Runtime::PathName::DefaultLogLocation));
@@ -187,6 +488,59 @@ namespace AppInstaller::Logging
         }
     }
 
+    void FileLogger::WriteLine(std::string_view message)
+    {
+        HandleMaximumFileSize(message);
+        m_stream << message << '\n';
+    }
+
+    void FileLogger::WriteQueuedLines()
+    {
+        if (!m_backgroundWriter)
+        {
+            return;
+        }
+
+        bool wroteLine = false;
+        std::string& line = m_backgroundWriter->CurrentLine;
+
+        while (m_backgroundWriter->Queue.TryPop(line))
+        {
+            WriteLine(line);
+            wroteLine = true;
+        }
+
+        if (wroteLine)
+        {
+            m_stream.flush();
+        }
+    }
+
+    void FileLogger::BackgroundWriterThread() try
+    {
+        for (;;)
+        {
+            {
+                std::lock_guard<std::mutex> lock{ m_streamLock };
+                WriteQueuedLines();
+            }
+
+            if (m_backgroundWriter->Stopping)
+            {
+                break;
+            }
+
+            // Announce the wait before checking the queue so that a line added after the check is sure to signal.
+            m_backgroundWriter->WriterWaiting = true;
+            if (m_backgroundWriter->Queue.IsEmpty() && !m_backgroundWriter->Stopping)
+            {
+                m_backgroundWriter->WorkAvailable.wait();
+            }
+            m_backgroundWriter->WriterWaiting = false;
+        }
+    }
+    catch (...) {}
+
     void FileLogger::InitializeDefaultMaximumFileSize()
     {
         m_maximumSize = static_cast<std::ofstream::off_type>(Settings::User().Get<Settings::Setting::LoggingFileIndividualSizeLimitInMB>()) << 20;
@@ -5,6 +5,7 @@
 #include <AppInstallerRuntime.h>
 #include <winget/HttpClientHelper.h>
 #include <winget/NetworkSettings.h>
+#include <winget/UserSettings.h>
 #include <winhttp.h>
 
 namespace AppInstaller::Http
@@ -50,8 +51,114 @@ namespace AppInstaller::Http
 
             return 0s;
         }
+
+        std::optional<std::string> SerializeHandlerResult(const std::optional<web::json::value>& result)
+        {
+            if (!result)
+            {
+                return {};
+            }
+
+            return utility::conversions::to_utf8string(result->serialize());
+        }
+
+        // A read-only stream buffer over a string that outlives it.
+        struct StringViewBuffer : public std::streambuf
+        {
+            StringViewBuffer(std::string_view contents)
+            {
+                char* begin = const_cast<char*>(contents.data());
+                setg(begin, begin, begin + contents.size());
+            }
+        };
     }
 
+    struct HttpClientHelper::ClientPool
+    {
+        ClientPool(const web::http::client::http_client_config& clientConfig, std::shared_ptr<web::http::http_pipeline_stage> stage) :
+            m_clientConfig(clientConfig), m_defaultRequestHandlerStage(std::move(stage)),
+            m_maxSize(Settings::User().Get<Settings::Setting::NetworkHttpClientPoolSize>()),
+            m_idleTimeout(Settings::User().Get<Settings::Setting::NetworkHttpClientIdleTimeoutInSeconds>())
+        {}
+
+        ~ClientPool()
+        {
+            if (m_clientsCreated || m_clientsReused)
+            {
+                AICLI_LOG(Repo, Verbose, << "HTTP client pool created " << m_clientsCreated << " clients and reused them " << m_clientsReused << " times");
+            }
+        }
+
+        web::http::client::http_client GetClient(const web::uri& uri)
+        {
+            web::uri baseUri = uri.authority();
+            utility::string_t key = baseUri.to_string();
+            auto now = std::chrono::steady_clock::now();
+
+            std::lock_guard<std::mutex> lock{ m_lock };
+
+            for (auto itr = m_clients.begin(); itr != m_clients.end();)
+            {
+                if (now - itr->second.LastUsed > m_idleTimeout)
+                {
+                    itr = m_clients.erase(itr);
+                }
+                else
+                {
+                    ++itr;
+                }
+            }
+
+            auto existing = m_clients.find(key);
+            if (existing != m_clients.end())
+            {
+                ++m_clientsReused;
+                existing->second.LastUsed = now;
+                return existing->second.Client;
+            }
+
+            web::http::client::http_client client{ baseUri, m_clientConfig };
+
+            // Add default custom handlers if any.
+            if (m_defaultRequestHandlerStage)
+            {
+                client.add_handler(m_defaultRequestHandlerStage);
+            }
+
+            ++m_clientsCreated;
+
+            if (m_maxSize > 0)
+            {
+                if (m_clients.size() >= m_maxSize)
+                {
+                    auto leastRecentlyUsed = std::min_element(m_clients.begin(), m_clients.end(), [](const auto& a, const auto& b) { return a.second.LastUsed < b.second.LastUsed; });
+                    m_clients.erase(leastRecentlyUsed);
+                }
+
+                m_clients.emplace(std::move(key), Entry{ client, now });
+            }
+
+            return client;
+        }
+
+    private:
+        struct Entry
+        {
+            web::http::client::http_client Client;
+            std::chrono::steady_clock::time_point LastUsed;
+        };
+
+        web::http::client::http_client_config m_clientConfig;
+        std::shared_ptr<web::http::http_pipeline_stage> m_defaultRequestHandlerStage;
+        size_t m_maxSize;
+        std::chrono::seconds m_idleTimeout;
+
+        std::mutex m_lock;
+        std::map<utility::string_t, Entry> m_clients;
+        size_t m_clientsCreated = 0;
+        size_t m_clientsReused = 0;
+    };
+
     HttpClientHelper::HttpClientHelper(std::shared_ptr<web::http::http_pipeline_stage> stage)
         : m_defaultRequestHandlerStage(std::move(stage))
     {
@@ -65,6 +172,8 @@ namespace AppInstaller::Http
         {
             AICLI_LOG(Repo, Info, << "REST HTTP Client helper does not use proxy");
         }
+
+        m_clientPool = std::make_shared<ClientPool>(m_clientConfig, m_defaultRequestHandlerStage);
     }
 
     pplx::task<web::http::http_response> HttpClientHelper::Post(
@@ -74,8 +183,10 @@ namespace AppInstaller::Http
         const HttpClientHelper::HttpRequestHeaders& authHeaders) const
     {
         AICLI_LOG(Repo, Info, << "Sending http POST request to: " << utility::conversions::to_utf8string(uri));
-        web::http::client::http_client client = GetClient(uri);
+        web::uri requestUri{ uri };
+        web::http::client::http_client client = GetClient(requestUri);
         web::http::http_request request{ web::http::methods::POST };
+        request.set_request_uri(requestUri.resource());
         request.headers().set_content_type(web::http::details::mime_types::application_json);
         request.set_body(body.serialize());
 
@@ -132,8 +243,10 @@ namespace AppInstaller::Http
         const HttpClientHelper::HttpRequestHeaders& authHeaders) const
     {
         AICLI_LOG(Repo, Info, << "Sending http GET request to: " << utility::conversions::to_utf8string(uri));
-        web::http::client::http_client client = GetClient(uri);
+        web::uri requestUri{ uri };
+        web::http::client::http_client client = GetClient(requestUri);
         web::http::http_request request{ web::http::methods::GET };
+        request.set_request_uri(requestUri.resource());
         request.headers().set_content_type(web::http::details::mime_types::application_json);
 
         // Add headers
@@ -182,46 +295,129 @@ namespace AppInstaller::Http
         RethrowAsWilException(exception);
     }
 
+    std::optional<std::string> HttpClientHelper::HandlePostForBody(
+        const utility::string_t& uri,
+        const web::json::value& body,
+        const HttpClientHelper::HttpRequestHeaders& headers,
+        const HttpClientHelper::HttpRequestHeaders& authHeaders,
+        const HttpResponseHandler& customHandler) const try
+    {
+        web::http::http_response httpResponse;
+        Post(uri, body, headers, authHeaders).then([&httpResponse](const web::http::http_response& response)
+            {
+                httpResponse = response;
+            }).wait();
+
+        if (customHandler)
+        {
+            auto handlerResult = customHandler(httpResponse);
+            if (!handlerResult.UseDefaultHandling)
+            {
+                return SerializeHandlerResult(handlerResult.Result);
+            }
+        }
+
+        return ValidateAndExtractBody(httpResponse);
+    }
+    catch (web::http::http_exception& exception)
+    {
+        RethrowAsWilException(exception);
+    }
+
+    std::optional<std::string> HttpClientHelper::HandleGetForBody(
+        const utility::string_t& uri,
+        const HttpClientHelper::HttpRequestHeaders& headers,
+        const HttpClientHelper::HttpRequestHeaders& authHeaders,
+        const HttpResponseHandler& customHandler) const try
+    {
+        web::http::http_response httpResponse;
+        Get(uri, headers, authHeaders).then([&httpResponse](const web::http::http_response& response)
+            {
+                httpResponse = response;
+            }).wait();
+
+        if (customHandler)
+        {
+            auto handlerResult = customHandler(httpResponse);
+            if (!handlerResult.UseDefaultHandling)
+            {
+                return SerializeHandlerResult(handlerResult.Result);
+            }
+        }
+
+        return ValidateAndExtractBody(httpResponse);
+    }
+    catch (web::http::http_exception& exception)
+    {
+        RethrowAsWilException(exception);
+    }
+
+    web::json::value HttpClientHelper::ParseJsonBody(std::string_view body)
+    {
+        if (body.empty())
+        {
+            return web::json::value{};
+        }
+
+        StringViewBuffer bodyBuffer{ body };
+        std::istream bodyStream{ &bodyBuffer };
+        return web::json::value::parse(bodyStream);
+    }
+
     void HttpClientHelper::SetPinningConfiguration(const Certificates::PinningConfiguration& configuration, std::shared_ptr<ThreadLocalStorage::ThreadGlobals> threadGlobals)
     {
         m_clientConfig.set_nativehandle_servercertificate_validation([pinConfig = configuration, globals = std::move(threadGlobals)](web::http::client::native_handle handle)
             {
                 NativeHandleServerCertificateValidation(handle, pinConfig, globals.get());
             });
+
+        // Existing clients were created with the previous configuration.
+        m_clientPool = std::make_shared<ClientPool>(m_clientConfig, m_defaultRequestHandlerStage);
     }
 
-    web::http::client::http_client HttpClientHelper::GetClient(const utility::string_t& uri) const
+    web::http::client::http_client HttpClientHelper::GetClient(const web::uri& uri) const
     {
-        web::http::client::http_client client{ uri, m_clientConfig };
+        return m_clientPool->GetClient(uri);
+    }
 
-        // Add default custom handlers if any.
-        if (m_defaultRequestHandlerStage)
+    std::optional<web::json::value> HttpClientHelper::ValidateAndExtractResponse(const web::http::http_response& response) const
+    {
+        if (!ValidateResponse(response))
         {
-            client.add_handler(m_defaultRequestHandlerStage);
+            return {};
         }
 
-        return client;
+        return ExtractJsonResponse(response);
     }
 
-    std::optional<web::json::value> HttpClientHelper::ValidateAndExtractResponse(const web::http::http_response& response) const
+    std::optional<std::string> HttpClientHelper::ValidateAndExtractBody(const web::http::http_response& response) const
+    {
+        if (!ValidateResponse(response))
+        {
+            return {};
+        }
+
+        return ExtractJsonBody(response);
+    }
+
+    bool HttpClientHelper::ValidateResponse(const web::http::http_response& response) const
     {
         AICLI_LOG(Repo, Info, << "Response status: " << response.status_code());
         // Ensure that we wait for the content to be ready before we log it; otherwise it will be truncated.
         AICLI_LOG_LARGE_STRING(Repo, Verbose, << "Response details:",
             response.content_ready().then([&](const web::http::http_response&) { return utility::conversions::to_utf8string(response.to_string()); }).get());
 
-        std::optional<web::json::value> result;
+        bool result = false;
         switch (response.status_code())
         {
         case web::http::status_codes::OK:
-            result = ExtractJsonResponse(response);
+            result = true;
             break;
 
         case web::http::status_codes::NotFound:
             THROW_HR(APPINSTALLER_CLI_ERROR_RESTAPI_ENDPOINT_NOT_FOUND);
 
         case web::http::status_codes::NoContent:
-            result = {};
             break;
 
         case web::http::status_codes::BadRequest:
@@ -239,13 +435,19 @@ namespace AppInstaller::Http
     }
 
     std::optional<web::json::value> HttpClientHelper::ExtractJsonResponse(const web::http::http_response& response) const
+    {
+        return ParseJsonBody(ExtractJsonBody(response));
+    }
+
+    std::string HttpClientHelper::ExtractJsonBody(const web::http::http_response& response) const
     {
         utility::string_t contentType = response.headers().content_type();
 
         THROW_HR_IF(APPINSTALLER_CLI_ERROR_RESTAPI_UNSUPPORTED_MIME_TYPE,
             !contentType._Starts_with(web::http::details::mime_types::application_json));
 
-        return response.extract_json().get();
+        // extract_json would convert the entire body to a UTF-16 string before it is parsed.
+        return response.extract_utf8string(true).get();
     }
 
     [[noreturn]] void HttpClientHelper::RethrowAsWilException(const web::http::http_exception& exception)
@@ -0,0 +1,197 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Public/winget/InstallerCache.h"
+#include "Public/winget/UserSettings.h"
+#include <AppInstallerLogging.h>
+#include <AppInstallerRuntime.h>
+#include <AppInstallerStrings.h>
+#include <AppInstallerSynchronization.h>
+
+namespace AppInstaller::Caching
+{
+    namespace
+    {
+        constexpr uint64_t s_BytesPerMegabyte = 1024 * 1024;
+
+        struct CacheEntry
+        {
+            std::filesystem::path Path;
+            uint64_t Size = 0;
+            std::filesystem::file_time_type LastUsed;
+        };
+
+        // Marks the entry as recently used; the modified time of an entry is its last use.
+        void TouchEntry(const std::filesystem::path& entryPath)
+        {
+            std::error_code error;
+            std::filesystem::last_write_time(entryPath, std::filesystem::file_time_type::clock::now(), error);
+
+            if (error)
+            {
+                AICLI_LOG(Core, Verbose, << "Failed to update last use of installer cache entry: " << error.message());
+            }
+        }
+    }
+
+    InstallerCache::InstallerCache(std::filesystem::path directory, uint64_t maximumSizeInBytes) :
+        m_directory(std::move(directory)), m_maximumSizeInBytes(maximumSizeInBytes) {}
+
+    std::optional<InstallerCache> InstallerCache::CreateFromUserSettings()
+    {
+        uint32_t maximumSizeInMB = Settings::User().Get<Settings::Setting::InstallerCacheMaximumSizeInMB>();
+        if (maximumSizeInMB == 0)
+        {
+            return std::nullopt;
+        }
+
+        std::filesystem::path directory = Settings::User().Get<Settings::Setting::InstallerCacheDirectory>();
+        if (directory.empty())
+        {
+            directory = Runtime::GetPathTo(Runtime::PathName::Temp) / "InstallerCache";
+        }
+
+        return InstallerCache{ std::move(directory), maximumSizeInMB * s_BytesPerMegabyte };
+    }
+
+    const std::filesystem::path& InstallerCache::GetDirectory() const
+    {
+        return m_directory;
+    }
+
+    std::optional<Utility::SHA256::HashDetails> InstallerCache::TryGet(const Utility::SHA256::HashBuffer& hash, const std::filesystem::path& target) const try
+    {
+        std::filesystem::path entryPath = GetEntryPath(hash);
+        if (!std::filesystem::exists(entryPath))
+        {
+            return std::nullopt;
+        }
+
+        AICLI_LOG(Core, Info, << "Found installer in cache at '" << entryPath << "'. Verifying file hash.");
+
+        // Hash the copy rather than the entry, as the copy is what will be used and the entry may be changed by others.
+        std::filesystem::copy_file(entryPath, target, std::filesystem::copy_options::overwrite_existing);
+
+        Utility::SHA256::HashDetails hashDetails = Utility::SHA256::ComputeHashDetailsFromFile(target);
+
+        if (!Utility::SHA256::AreEqual(hash, hashDetails.Hash))
+        {
+            AICLI_LOG(Core, Warning, << "Installer cache entry hash does not match; removing it: " << entryPath);
+
+            std::error_code error;
+            std::filesystem::remove(target, error);
+            std::filesystem::remove(entryPath, error);
+            return std::nullopt;
+        }
+
+        TouchEntry(entryPath);
+        return hashDetails;
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION_MSG("InstallerCache::TryGet exception");
+
+        std::error_code error;
+        std::filesystem::remove(target, error);
+        return std::nullopt;
+    }
+
+    void InstallerCache::Add(const Utility::SHA256::HashBuffer& hash, const std::filesystem::path& file) const try
+    {
+        if (std::filesystem::file_size(file) > m_maximumSizeInBytes)
+        {
+            AICLI_LOG(Core, Info, << "Installer is larger than the installer cache, not adding it");
+            return;
+        }
+
+        std::filesystem::path entryPath = GetEntryPath(hash);
+
+        if (std::filesystem::exists(entryPath))
+        {
+            TouchEntry(entryPath);
+            return;
+        }
+
+        std::filesystem::create_directories(m_directory);
+
+        // Copy to the side and move into place so that a partial entry is never used.
+        std::filesystem::path tempPath = entryPath;
+        tempPath += L'.' + Utility::CreateNewGuidNameWString() + L".tmp";
+
+        std::filesystem::copy_file(file, tempPath);
+
+        try
+        {
+            std::filesystem::rename(tempPath, entryPath);
+        }
+        catch (...)
+        {
+            // Most likely another process added the same entry at the same time.
+            std::error_code error;
+            std::filesystem::remove(tempPath, error);
+            throw;
+        }
+
+        AICLI_LOG(Core, Info, << "Added installer to cache at '" << entryPath << "'");
+
+        Evict();
+    }
+    CATCH_LOG_MSG("InstallerCache::Add exception");
+
+    std::filesystem::path InstallerCache::GetEntryPath(const Utility::SHA256::HashBuffer& hash) const
+    {
+        return m_directory / Utility::SHA256::ConvertToString(hash);
+    }
+
+    void InstallerCache::Evict() const
+    {
+        // Another process evicting will leave the cache within the limit as well.
+        Synchronization::CrossProcessLock lock{ "WinGetInstallerCacheEviction" };
+        if (!lock.TryAcquireNoWait())
+        {
+            return;
+        }
+
+        std::vector<CacheEntry> entries;
+        uint64_t totalSize = 0;
+
+        for (const auto& directoryEntry : std::filesystem::directory_iterator{ m_directory })
+        {
+            // Entries are named by their hash alone; anything else is an entry being added.
+            if (!directoryEntry.is_regular_file() || directoryEntry.path().has_extension())
+            {
+                continue;
+            }
+
+            CacheEntry entry;
+            entry.Path = directoryEntry.path();
+            entry.Size = directoryEntry.file_size();
+            entry.LastUsed = directoryEntry.last_write_time();
+
+            totalSize += entry.Size;
+            entries.emplace_back(std::move(entry));
+        }
+
+        if (totalSize <= m_maximumSizeInBytes)
+        {
+            return;
+        }
+
+        std::sort(entries.begin(), entries.end(), [](const CacheEntry& a, const CacheEntry& b) { return a.LastUsed < b.LastUsed; });
+
+        for (const CacheEntry& entry : entries)
+        {
+            if (totalSize <= m_maximumSizeInBytes)
+            {
+                break;
+            }
+
+            std::error_code error;
+            if (std::filesystem::remove(entry.Path, error))
+            {
+                AICLI_LOG(Core, Info, << "Evicted installer cache entry: " << entry.Path);
+                totalSize -= entry.Size;
+            }
+        }
+    }
+}
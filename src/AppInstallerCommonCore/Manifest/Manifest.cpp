@@ -18,6 +18,31 @@ namespace AppInstaller::Manifest
         }
     }
 
+    // A localization kept in its parsed form; it is populated once, on first use.
+    struct Manifest::DeferredLocalization
+    {
+        DeferredLocalization(string_t locale, std::function<ManifestLocalization()> populate) :
+            Locale(std::move(locale)), m_populate(std::move(populate)) {}
+
+        const string_t Locale;
+
+        const ManifestLocalization& Get()
+        {
+            std::call_once(m_populated, [&]()
+                {
+                    m_localization = m_populate();
+                    m_populate = nullptr;
+                });
+
+            return m_localization;
+        }
+
+    private:
+        std::function<ManifestLocalization()> m_populate;
+        std::once_flag m_populated;
+        ManifestLocalization m_localization;
+    };
+
     void Manifest::ApplyLocale(const std::string& locale)
     {
         CurrentLocalization = DefaultLocalization;
@@ -36,6 +61,7 @@ namespace AppInstaller::Manifest
         for (auto const& targetLocale : targetLocales)
         {
             const ManifestLocalization* bestLocalization = nullptr;
+            DeferredLocalization* bestDeferredLocalization = nullptr;
             double bestScore = Locale::GetDistanceOfLanguage(targetLocale, DefaultLocalization.Locale);
 
             for (auto const& localization : Localizations)
@@ -48,9 +74,25 @@ namespace AppInstaller::Manifest
                 }
             }
 
+            for (auto const& deferredLocalization : m_deferredLocalizations)
+            {
+                double score = Locale::GetDistanceOfLanguage(targetLocale, deferredLocalization->Locale);
+                if (score > bestScore)
+                {
+                    bestDeferredLocalization = deferredLocalization.get();
+                    bestScore = score;
+                }
+            }
+
             // If there's better locale than default And is compatible with target locale, merge and return;
             if (bestScore >= Locale::MinimumDistanceScoreAsCompatibleMatch)
             {
+                // Only the selected deferred localization is populated
+                if (bestDeferredLocalization != nullptr)
+                {
+                    bestLocalization = &bestDeferredLocalization->Get();
+                }
+
                 if (bestLocalization != nullptr)
                 {
                     CurrentLocalization.ReplaceOrMergeWith(*bestLocalization);
@@ -60,21 +102,67 @@ namespace AppInstaller::Manifest
         }
     }
 
+    void Manifest::AddDeferredLocalization(string_t locale, std::function<ManifestLocalization()> populate)
+    {
+        m_deferredLocalizations.emplace_back(std::make_shared<DeferredLocalization>(std::move(locale), std::move(populate)));
+    }
+
+    void Manifest::MaterializeLocalizations()
+    {
+        for (auto const& deferredLocalization : m_deferredLocalizations)
+        {
+            Localizations.emplace_back(deferredLocalization->Get());
+        }
+
+        m_deferredLocalizations.clear();
+    }
+
+    void Manifest::ForEachLocalization(const std::function<void(const ManifestLocalization&)>& callback) const
+    {
+        for (const auto& localization : Localizations)
+        {
+            callback(localization);
+        }
+
+        for (const auto& deferredLocalization : m_deferredLocalizations)
+        {
+            callback(deferredLocalization->Get());
+        }
+    }
+
+    std::vector<string_t> Manifest::GetLocalizationLocales() const
+    {
+        std::vector<string_t> result;
+        result.reserve(Localizations.size() + m_deferredLocalizations.size());
+
+        for (const auto& localization : Localizations)
+        {
+            result.emplace_back(localization.Locale);
+        }
+
+        for (const auto& deferredLocalization : m_deferredLocalizations)
+        {
+            result.emplace_back(deferredLocalization->Locale);
+        }
+
+        return result;
+    }
+
     std::vector<string_t> Manifest::GetAggregatedTags() const
     {
         std::vector<string_t> resultTags = DefaultLocalization.Get<Localization::Tags>();
 
-        for (const auto& locale : Localizations)
-        {
-            auto tags = locale.Get<Localization::Tags>();
-            for (const auto& tag : tags)
+        ForEachLocalization([&](const ManifestLocalization& locale)
             {
-                if (std::find(resultTags.begin(), resultTags.end(), tag) == resultTags.end())
+                auto tags = locale.Get<Localization::Tags>();
+                for (const auto& tag : tags)
                 {
-                    resultTags.emplace_back(tag);
+                    if (std::find(resultTags.begin(), resultTags.end(), tag) == resultTags.end())
+                    {
+                        resultTags.emplace_back(tag);
+                    }
                 }
-            }
-        }
+            });
 
         return resultTags;
     }
@@ -163,10 +251,10 @@ namespace AppInstaller::Manifest
         std::set<string_t> set;
 
         AddFoldedStringToSetIfNotEmpty(set, DefaultLocalization.Get<Localization::PackageName>());
-        for (const auto& loc : Localizations)
-        {
-            AddFoldedStringToSetIfNotEmpty(set, loc.Get<Localization::PackageName>());
-        }
+        ForEachLocalization([&](const ManifestLocalization& loc)
+            {
+                AddFoldedStringToSetIfNotEmpty(set, loc.Get<Localization::PackageName>());
+            });
 
         // In addition to the names used for our display, add the display names from the ARP entries
         for (const auto& installer : Installers)
@@ -189,10 +277,10 @@ namespace AppInstaller::Manifest
         std::set<string_t> set;
 
         AddFoldedStringToSetIfNotEmpty(set, DefaultLocalization.Get<Localization::Publisher>());
-        for (const auto& loc : Localizations)
-        {
-            AddFoldedStringToSetIfNotEmpty(set, loc.Get<Localization::Publisher>());
-        }
+        ForEachLocalization([&](const ManifestLocalization& loc)
+            {
+                AddFoldedStringToSetIfNotEmpty(set, loc.Get<Localization::Publisher>());
+            });
 
         // In addition to the publishers used for our display, add the publisher from the ARP entries
         for (const auto& installer : Installers)
@@ -117,7 +117,7 @@ namespace AppInstaller::Manifest
         return false;
     }
 
-    InstallerTypeEnum ConvertToInstallerTypeEnum(const std::string& in)
+    InstallerTypeEnum ConvertToInstallerTypeEnum(std::string_view in)
     {
         std::string inStrLower = Utility::ToLower(in);
         InstallerTypeEnum result = InstallerTypeEnum::Unknown;
@@ -170,7 +170,7 @@ namespace AppInstaller::Manifest
         return result;
     }
 
-    UpdateBehaviorEnum ConvertToUpdateBehaviorEnum(const std::string& in)
+    UpdateBehaviorEnum ConvertToUpdateBehaviorEnum(std::string_view in)
     {
         UpdateBehaviorEnum result = UpdateBehaviorEnum::Unknown;
 
@@ -206,7 +206,7 @@ namespace AppInstaller::Manifest
         return result;
     }
 
-    InstallModeEnum ConvertToInstallModeEnum(const std::string& in)
+    InstallModeEnum ConvertToInstallModeEnum(std::string_view in)
     {
         InstallModeEnum result = InstallModeEnum::Unknown;
 
@@ -270,7 +270,7 @@ namespace AppInstaller::Manifest
         return PlatformEnum::Unknown;
     }
 
-    ElevationRequirementEnum ConvertToElevationRequirementEnum(const std::string& in)
+    ElevationRequirementEnum ConvertToElevationRequirementEnum(std::string_view in)
     {
         ElevationRequirementEnum result = ElevationRequirementEnum::Unknown;
 
@@ -290,7 +290,7 @@ namespace AppInstaller::Manifest
         return result;
     }
 
-    UnsupportedArgumentEnum ConvertToUnsupportedArgumentEnum(const std::string& in)
+    UnsupportedArgumentEnum ConvertToUnsupportedArgumentEnum(std::string_view in)
     {
         UnsupportedArgumentEnum result = UnsupportedArgumentEnum::Unknown;
 
@@ -306,7 +306,7 @@ namespace AppInstaller::Manifest
         return result;
     }
 
-    ManifestTypeEnum ConvertToManifestTypeEnum(const std::string& in)
+    ManifestTypeEnum ConvertToManifestTypeEnum(std::string_view in)
     {
         if (in == "singleton")
         {
@@ -338,11 +338,11 @@ namespace AppInstaller::Manifest
         }
         else
         {
-            THROW_HR_MSG(HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED), "Unsupported ManifestType: %hs", in.c_str());
+            THROW_HR_MSG(HRESULT_FROM_WIN32(ERROR_NOT_SUPPORTED), "Unsupported ManifestType: %hs", std::string{ in }.c_str());
         }
     }
 
-    ExpectedReturnCodeEnum ConvertToExpectedReturnCodeEnum(const std::string& in)
+    ExpectedReturnCodeEnum ConvertToExpectedReturnCodeEnum(std::string_view in)
     {
         std::string inStrLower = Utility::ToLower(in);
         ExpectedReturnCodeEnum result = ExpectedReturnCodeEnum::Unknown;
@@ -427,7 +427,7 @@ namespace AppInstaller::Manifest
         return result;
     }
 
-    InstalledFileTypeEnum ConvertToInstalledFileTypeEnum(const std::string& in)
+    InstalledFileTypeEnum ConvertToInstalledFileTypeEnum(std::string_view in)
     {
         std::string inStrLower = Utility::ToLower(in);
         InstalledFileTypeEnum result = InstalledFileTypeEnum::Unknown;
@@ -7,6 +7,7 @@
 #include "winget/ManifestSchemaValidation.h"
 #include "winget/ManifestYamlParser.h"
 #include "winget/Resources.h"
+#include "ManifestSchemaYamlAdapter.h"
 
 #include <ManifestSchema.h>
 
@@ -16,13 +17,6 @@ namespace AppInstaller::Manifest::YamlParser
 
     namespace
     {
-        enum class YamlScalarType
-        {
-            String,
-            Int,
-            Bool
-        };
-
         // List of fields that use non string scalar types
         const std::map<std::string_view, YamlScalarType> ManifestFieldTypes =
         {
@@ -36,69 +30,6 @@ namespace AppInstaller::Manifest::YamlParser
             { "ArchiveBinariesDependOnPath", YamlScalarType::Bool }
         };
 
-        YamlScalarType GetManifestScalarValueType(const std::string& key)
-        {
-            auto iter = ManifestFieldTypes.find(key);
-            if (iter != ManifestFieldTypes.end())
-            {
-                return iter->second;
-            }
-
-            return YamlScalarType::String;
-        }
-
-        Json::Value YamlScalarNodeToJson(const YAML::Node& scalarNode, YamlScalarType scalarType)
-        {
-            if (scalarType == YamlScalarType::Int)
-            {
-                return Json::Value(scalarNode.as<int>());
-            }
-            else if (scalarType == YamlScalarType::Bool)
-            {
-                return Json::Value(scalarNode.as<bool>());
-            }
-            else
-            {
-                return Json::Value(scalarNode.as<std::string>());
-            }
-        }
-
-        Json::Value ManifestYamlNodeToJson(const YAML::Node& rootNode, YamlScalarType scalarType = YamlScalarType::String)
-        {
-            Json::Value result;
-
-            if (rootNode.IsNull())
-            {
-                result = Json::Value::nullSingleton();
-            }
-            else if (rootNode.IsMap())
-            {
-                for (auto const& keyValuePair : rootNode.Mapping())
-                {
-                    // We only support string type as key in our manifest
-                    auto key = keyValuePair.first.as<std::string>();
-                    result[keyValuePair.first.as<std::string>()] = ManifestYamlNodeToJson(keyValuePair.second, GetManifestScalarValueType(key));
-                }
-            }
-            else if (rootNode.IsSequence())
-            {
-                for (auto const& value : rootNode.Sequence())
-                {
-                    result.append(ManifestYamlNodeToJson(value, scalarType));
-                }
-            }
-            else if (rootNode.IsScalar())
-            {
-                result = YamlScalarNodeToJson(rootNode, scalarType);
-            }
-            else
-            {
-                THROW_HR(E_UNEXPECTED);
-            }
-
-            return result;
-        }
-
         std::vector<ValidationError> ParseSchemaHeaderString(const YamlManifestInfo& manifestInfo, const ValidationError::Level& errorLevel, std::string& schemaHeaderUrlString)
         {
             std::vector<ValidationError> errors;
@@ -267,6 +198,17 @@ namespace AppInstaller::Manifest::YamlParser
         }
     }
 
+    YamlScalarType GetManifestScalarValueType(std::string_view key)
+    {
+        auto iter = ManifestFieldTypes.find(key);
+        if (iter != ManifestFieldTypes.end())
+        {
+            return iter->second;
+        }
+
+        return YamlScalarType::String;
+    }
+
     Json::Value LoadSchemaDoc(const ManifestVer& manifestVersion, ManifestTypeEnum manifestType)
     {
         int idx = MANIFESTSCHEMA_NO_RESOURCE;
@@ -437,10 +379,10 @@ namespace AppInstaller::Manifest::YamlParser
             }
 
             const auto& schema = schemaList.find(entry.ManifestType)->second;
-            Json::Value manifestJson = ManifestYamlNodeToJson(entry.Root);
+            ManifestYamlAdapter manifestAdapter(entry.Root);
             valijson::ValidationResults results;
 
-            if (!JsonSchema::Validate(schema, manifestJson, results))
+            if (!JsonSchema::Validate(schema, manifestAdapter, results))
             {
                 errors.emplace_back(ValidationError::MessageContextWithFile(ManifestError::SchemaError, JsonSchema::GetErrorStringFromResults(results), entry.FileName));
             }
@@ -0,0 +1,336 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include "winget/Yaml.h"
+
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace AppInstaller::Manifest::YamlParser
+{
+    // The type a YAML scalar is interpreted as during schema validation.
+    enum class YamlScalarType
+    {
+        String,
+        Int,
+        Bool
+    };
+
+    // Gets the scalar type of the value for the given manifest field.
+    YamlScalarType GetManifestScalarValueType(std::string_view key);
+
+    class ManifestYamlAdapter;
+    class ManifestYamlArrayValueIterator;
+    class ManifestYamlObjectMemberIterator;
+
+    // The key refers to the scalar in the mapping rather than a copy of it.
+    using ManifestYamlObjectMember = std::pair<const std::string&, ManifestYamlAdapter>;
+
+    // A view over a YAML sequence node.
+    class ManifestYamlArray
+    {
+    public:
+        using const_iterator = ManifestYamlArrayValueIterator;
+        using iterator = ManifestYamlArrayValueIterator;
+
+        ManifestYamlArray() : m_node(EmptySequence()) {}
+        ManifestYamlArray(const YAML::Node& node, YamlScalarType scalarType) : m_node(node), m_scalarType(scalarType) {}
+
+        ManifestYamlArrayValueIterator begin() const;
+        ManifestYamlArrayValueIterator end() const;
+
+        size_t size() const { return m_node.size(); }
+
+    private:
+        static const YAML::Node& EmptySequence();
+
+        const YAML::Node& m_node;
+        YamlScalarType m_scalarType = YamlScalarType::String;
+    };
+
+    // A view over a YAML mapping node.
+    class ManifestYamlObject
+    {
+    public:
+        using const_iterator = ManifestYamlObjectMemberIterator;
+        using iterator = ManifestYamlObjectMemberIterator;
+
+        ManifestYamlObject() : m_node(EmptyMapping()) {}
+        ManifestYamlObject(const YAML::Node& node) : m_node(node) {}
+
+        ManifestYamlObjectMemberIterator begin() const;
+        ManifestYamlObjectMemberIterator end() const;
+        ManifestYamlObjectMemberIterator find(const std::string& propertyName) const;
+
+        size_t size() const { return m_node.size(); }
+
+    private:
+        static const YAML::Node& EmptyMapping();
+
+        const YAML::Node& m_node;
+    };
+
+    // A copy of a YAML node that can outlive the document it came from.
+    class ManifestYamlFrozenValue : public valijson::adapters::FrozenValue
+    {
+    public:
+        ManifestYamlFrozenValue(const YAML::Node& node, YamlScalarType scalarType) : m_node(node), m_scalarType(scalarType) {}
+
+        valijson::adapters::FrozenValue* clone() const override { return new ManifestYamlFrozenValue(m_node, m_scalarType); }
+
+        bool equalTo(const valijson::adapters::Adapter& other, bool strict) const override;
+
+    private:
+        const YAML::Node m_node;
+        YamlScalarType m_scalarType;
+    };
+
+    // Exposes a YAML node to valijson, applying the manifest field scalar types so that
+    // validation can run directly over the parsed YAML without a JSON intermediate.
+    class ManifestYamlValue
+    {
+    public:
+        ManifestYamlValue() : m_node(&EmptyNode()) {}
+        ManifestYamlValue(const YAML::Node& node, YamlScalarType scalarType = YamlScalarType::String) : m_node(&node), m_scalarType(scalarType) {}
+
+        valijson::adapters::FrozenValue* freeze() const { return new ManifestYamlFrozenValue(*m_node, m_scalarType); }
+
+        opt::optional<ManifestYamlArray> getArrayOptional() const
+        {
+            if (isArray())
+            {
+                return opt::make_optional(ManifestYamlArray(*m_node, m_scalarType));
+            }
+
+            return {};
+        }
+
+        bool getArraySize(size_t& result) const
+        {
+            if (isArray())
+            {
+                result = m_node->size();
+                return true;
+            }
+
+            return false;
+        }
+
+        bool getBool(bool& result) const
+        {
+            if (isBool())
+            {
+                result = m_node->as<bool>();
+                return true;
+            }
+
+            return false;
+        }
+
+        bool getDouble(double& result) const
+        {
+            if (isInteger())
+            {
+                result = static_cast<double>(m_node->as<int>());
+                return true;
+            }
+
+            return false;
+        }
+
+        bool getInteger(int64_t& result) const
+        {
+            if (isInteger())
+            {
+                result = m_node->as<int>();
+                return true;
+            }
+
+            return false;
+        }
+
+        opt::optional<ManifestYamlObject> getObjectOptional() const
+        {
+            if (isObject())
+            {
+                return opt::make_optional(ManifestYamlObject(*m_node));
+            }
+
+            return {};
+        }
+
+        bool getObjectSize(size_t& result) const
+        {
+            if (isObject())
+            {
+                result = m_node->size();
+                return true;
+            }
+
+            return false;
+        }
+
+        bool getString(std::string& result) const
+        {
+            if (isString())
+            {
+                result = m_node->as<std::string>();
+                return true;
+            }
+
+            return false;
+        }
+
+        static bool hasStrictTypes() { return true; }
+
+        bool isArray() const { return !isNull() && m_node->IsSequence(); }
+        bool isBool() const { return IsTypedScalar(YamlScalarType::Bool); }
+        bool isDouble() const { return false; }
+        bool isInteger() const { return IsTypedScalar(YamlScalarType::Int); }
+        bool isNull() const { return m_node->IsNull(); }
+        bool isNumber() const { return isInteger(); }
+        bool isObject() const { return !isNull() && m_node->IsMap(); }
+        bool isString() const { return IsTypedScalar(YamlScalarType::String); }
+
+    private:
+        static const YAML::Node& EmptyNode();
+
+        bool IsTypedScalar(YamlScalarType type) const { return !isNull() && m_node->IsScalar() && m_scalarType == type; }
+
+        const YAML::Node* m_node;
+        YamlScalarType m_scalarType = YamlScalarType::String;
+    };
+
+    // The valijson adapter for manifest YAML nodes.
+    class ManifestYamlAdapter : public valijson::adapters::BasicAdapter<ManifestYamlAdapter, ManifestYamlArray, ManifestYamlObjectMember, ManifestYamlObject, ManifestYamlValue>
+    {
+    public:
+        ManifestYamlAdapter() : BasicAdapter() {}
+        ManifestYamlAdapter(const YAML::Node& node, YamlScalarType scalarType = YamlScalarType::String) : BasicAdapter(ManifestYamlValue{ node, scalarType }) {}
+    };
+
+    // Iterates the values of a sequence, propagating the scalar type of the sequence to its items.
+    class ManifestYamlArrayValueIterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = ManifestYamlAdapter;
+        using difference_type = ManifestYamlAdapter;
+        using pointer = ManifestYamlAdapter*;
+        using reference = ManifestYamlAdapter&;
+
+        ManifestYamlArrayValueIterator(std::vector<YAML::Node>::const_iterator itr, YamlScalarType scalarType) : m_itr(itr), m_scalarType(scalarType) {}
+
+        ManifestYamlAdapter operator*() const { return ManifestYamlAdapter(*m_itr, m_scalarType); }
+        valijson::adapters::DerefProxy<ManifestYamlAdapter> operator->() const { return valijson::adapters::DerefProxy<ManifestYamlAdapter>(**this); }
+
+        bool operator==(const ManifestYamlArrayValueIterator& other) const { return m_itr == other.m_itr; }
+        bool operator!=(const ManifestYamlArrayValueIterator& other) const { return m_itr != other.m_itr; }
+
+        const ManifestYamlArrayValueIterator& operator++() { ++m_itr; return *this; }
+        ManifestYamlArrayValueIterator operator++(int) { ManifestYamlArrayValueIterator result(*this); ++m_itr; return result; }
+        const ManifestYamlArrayValueIterator& operator--() { --m_itr; return *this; }
+        ManifestYamlArrayValueIterator operator--(int) { ManifestYamlArrayValueIterator result(*this); --m_itr; return result; }
+
+        void advance(std::ptrdiff_t n) { m_itr += n; }
+
+    private:
+        std::vector<YAML::Node>::const_iterator m_itr;
+        YamlScalarType m_scalarType;
+    };
+
+    // Iterates the members of a mapping, applying the scalar type of each manifest field to its value.
+    class ManifestYamlObjectMemberIterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = ManifestYamlObjectMember;
+        using difference_type = ManifestYamlObjectMember;
+        using pointer = ManifestYamlObjectMember*;
+        using reference = ManifestYamlObjectMember&;
+
+        ManifestYamlObjectMemberIterator(std::multimap<YAML::Node, YAML::Node>::const_iterator itr) : m_itr(itr) {}
+
+        ManifestYamlObjectMember operator*() const
+        {
+            // We only support string type as key in our manifest
+            const std::string& key = m_itr->first.GetScalar();
+            return ManifestYamlObjectMember(key, ManifestYamlAdapter(m_itr->second, GetManifestScalarValueType(key)));
+        }
+
+        valijson::adapters::DerefProxy<ManifestYamlObjectMember> operator->() const { return valijson::adapters::DerefProxy<ManifestYamlObjectMember>(**this); }
+
+        bool operator==(const ManifestYamlObjectMemberIterator& other) const { return m_itr == other.m_itr; }
+        bool operator!=(const ManifestYamlObjectMemberIterator& other) const { return m_itr != other.m_itr; }
+
+        const ManifestYamlObjectMemberIterator& operator++() { ++m_itr; return *this; }
+        ManifestYamlObjectMemberIterator operator++(int) { ManifestYamlObjectMemberIterator result(*this); ++m_itr; return result; }
+        const ManifestYamlObjectMemberIterator& operator--() { --m_itr; return *this; }
+        ManifestYamlObjectMemberIterator operator--(int) { ManifestYamlObjectMemberIterator result(*this); --m_itr; return result; }
+
+    private:
+        std::multimap<YAML::Node, YAML::Node>::const_iterator m_itr;
+    };
+
+    inline const YAML::Node& ManifestYamlArray::EmptySequence()
+    {
+        static const YAML::Node s_emptySequence{ YAML::Node::Type::Sequence, {}, {} };
+        return s_emptySequence;
+    }
+
+    inline const YAML::Node& ManifestYamlObject::EmptyMapping()
+    {
+        static const YAML::Node s_emptyMapping{ YAML::Node::Type::Mapping, {}, {} };
+        return s_emptyMapping;
+    }
+
+    inline const YAML::Node& ManifestYamlValue::EmptyNode()
+    {
+        static const YAML::Node s_emptyNode;
+        return s_emptyNode;
+    }
+
+    inline ManifestYamlArrayValueIterator ManifestYamlArray::begin() const
+    {
+        return { m_node.Sequence().begin(), m_scalarType };
+    }
+
+    inline ManifestYamlArrayValueIterator ManifestYamlArray::end() const
+    {
+        return { m_node.Sequence().end(), m_scalarType };
+    }
+
+    inline ManifestYamlObjectMemberIterator ManifestYamlObject::begin() const
+    {
+        return m_node.Mapping().begin();
+    }
+
+    inline ManifestYamlObjectMemberIterator ManifestYamlObject::end() const
+    {
+        return m_node.Mapping().end();
+    }
+
+    inline ManifestYamlObjectMemberIterator ManifestYamlObject::find(const std::string& propertyName) const
+    {
+        const auto& mapping = m_node.Mapping();
+        std::string_view name = propertyName;
+        return std::find_if(mapping.begin(), mapping.end(), [&](const auto& keyValuePair) { return keyValuePair.first.as_view() == name; });
+    }
+
+    inline bool ManifestYamlFrozenValue::equalTo(const valijson::adapters::Adapter& other, bool strict) const
+    {
+        return ManifestYamlAdapter(m_node, m_scalarType).equalTo(other, strict);
+    }
+}
+
+namespace valijson::adapters
+{
+    template <>
+    struct AdapterTraits<AppInstaller::Manifest::YamlParser::ManifestYamlAdapter>
+    {
+        typedef AppInstaller::YAML::Node DocumentType;
+
+        static std::string adapterName() { return "ManifestYamlAdapter"; }
+    };
+}
@@ -6,6 +6,7 @@
 #include "winget/ManifestSchemaValidation.h"
 #include "winget/ManifestYamlPopulator.h"
 #include "winget/ManifestYamlParser.h"
+#include "winget/Timing.h"
 
 namespace AppInstaller::Manifest::YamlParser
 {
@@ -516,6 +517,7 @@ namespace AppInstaller::Manifest::YamlParser
         ManifestValidateOption validateOption,
         const std::filesystem::path& mergedManifestPath)
     {
+        Timing::ScopedTimer timer{ Timing::Phase::ManifestParse };
         std::vector<YamlManifestInfo> docList;
 
         try
@@ -557,6 +559,7 @@ namespace AppInstaller::Manifest::YamlParser
         ManifestValidateOption validateOption,
         const std::filesystem::path& mergedManifestPath)
     {
+        Timing::ScopedTimer timer{ Timing::Phase::ManifestParse };
         std::vector<YamlManifestInfo> docList;
 
         try
@@ -575,6 +578,54 @@ namespace AppInstaller::Manifest::YamlParser
         return ParseManifest(docList, validateOption, mergedManifestPath);
     }
 
+    Manifest CreateWithBinary(
+        const std::string& input,
+        std::string& binaryOut,
+        ManifestValidateOption validateOption)
+    {
+        Timing::ScopedTimer timer{ Timing::Phase::ManifestParse };
+        std::vector<YamlManifestInfo> docList;
+
+        try
+        {
+            YamlManifestInfo manifestInfo;
+            YAML::Document doc = YAML::LoadDocument(input);
+            binaryOut = YAML::ConvertToBinary(doc);
+            manifestInfo.DocumentSchemaHeader = doc.GetSchemaHeader();
+            manifestInfo.Root = std::move(doc).GetRoot();
+            docList.emplace_back(std::move(manifestInfo));
+        }
+        catch (const std::exception& e)
+        {
+            THROW_EXCEPTION_MSG(ManifestException(), "%hs", e.what());
+        }
+
+        return ParseManifest(docList, validateOption);
+    }
+
+    Manifest CreateFromBinary(
+        std::string_view input,
+        ManifestValidateOption validateOption)
+    {
+        Timing::ScopedTimer timer{ Timing::Phase::ManifestParse };
+        std::vector<YamlManifestInfo> docList;
+
+        try
+        {
+            YamlManifestInfo manifestInfo;
+            YAML::Document doc = YAML::LoadDocumentFromBinary(input);
+            manifestInfo.DocumentSchemaHeader = doc.GetSchemaHeader();
+            manifestInfo.Root = std::move(doc).GetRoot();
+            docList.emplace_back(std::move(manifestInfo));
+        }
+        catch (const std::exception& e)
+        {
+            THROW_EXCEPTION_MSG(ManifestException(), "%hs", e.what());
+        }
+
+        return ParseManifest(docList, validateOption);
+    }
+
     Manifest ParseManifest(
         std::vector<YamlManifestInfo>& input,
         ManifestValidateOption validateOption,
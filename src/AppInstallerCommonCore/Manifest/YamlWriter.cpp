@@ -736,20 +736,26 @@ namespace AppInstaller::Manifest::YamlWriter
             out << YAML::EndSeq;
         }
 
-        void ProcessLocalizations(YAML::Emitter& out, const std::vector<ManifestLocalization>& localizations)
+        void ProcessLocalizations(YAML::Emitter& out, const Manifest& manifest)
         {
-            if (!localizations.empty())
-            {
-                out << YAML::Key << Localization;
-                out << YAML::BeginSeq;
+            bool sequenceStarted = false;
 
-                for (const auto& localization : localizations)
+            manifest.ForEachLocalization([&](const ManifestLocalization& localization)
                 {
+                    if (!sequenceStarted)
+                    {
+                        out << YAML::Key << Localization;
+                        out << YAML::BeginSeq;
+                        sequenceStarted = true;
+                    }
+
                     out << YAML::BeginMap;
                     ProcessLocaleFields(out, localization);
                     out << YAML::EndMap;
-                }
+                });
 
+            if (sequenceStarted)
+            {
                 out << YAML::EndSeq;
             }
         }
@@ -764,7 +770,7 @@ namespace AppInstaller::Manifest::YamlWriter
             WRITE_PROPERTY_IF_EXISTS(out, Channel, manifest.Channel);
             WRITE_PROPERTY_IF_EXISTS(out, Moniker, manifest.Moniker);
             ProcessLocaleFields(out, manifest.DefaultLocalization);
-            ProcessLocalizations(out, manifest.Localizations);
+            ProcessLocalizations(out, manifest);
             ProcessInstaller(out, installer);
             WRITE_PROPERTY(out, ManifestVersion, manifest.ManifestVersion.ToString());
 
@@ -24,6 +24,11 @@ namespace AppInstaller::Manifest
 
     static constexpr DWORD CompressionAlgorithm = COMPRESS_ALGORITHM_MSZIP;
     static constexpr bool CompressionSetLevel1 = false;
+    static constexpr size_t s_MaximumRetainedDecompressionBuffer = 1024 * 1024;
+
+    // Compressed data that begins with this marker is a zlib stream; anything else is from the Windows Compression API.
+    // Its buffer format always begins with its own signature, which this cannot be confused with.
+    static constexpr std::string_view s_ZlibFormatMarker = "WGz\x01"sv;
 
     namespace anon
     {
@@ -95,6 +100,23 @@ namespace AppInstaller::Manifest
         return Compression::Decompressor(CompressionAlgorithm);
     }
 
+    std::vector<uint8_t> PackageVersionDataManifest::Compress(std::string_view serialized, CompressionFormat format)
+    {
+        switch (format)
+        {
+        case CompressionFormat::MSZip:
+            return CreateCompressor().Compress(serialized);
+        case CompressionFormat::Zlib:
+        {
+            std::vector<uint8_t> compressed = Compression::ZlibCompressor{}.Compress(serialized);
+            compressed.insert(compressed.begin(), s_ZlibFormatMarker.begin(), s_ZlibFormatMarker.end());
+            return compressed;
+        }
+        }
+
+        THROW_HR(E_UNEXPECTED);
+    }
+
     PackageVersionDataManifest::VersionData::VersionData(
         const Utility::VersionAndChannel& versionAndChannel,
         std::optional<std::string> arpMinVersion,
@@ -186,4 +208,32 @@ namespace AppInstaller::Manifest
     {
         Deserialize(std::string_view{ reinterpret_cast<const char*>(input.data()), input.size() });
     }
+
+    void PackageVersionDataManifest::DeserializeCompressed(std::string_view input)
+    {
+        // Version data is decompressed for every package that is accessed, so the decompressors and their output buffer are kept for the thread.
+        thread_local std::vector<uint8_t> t_buffer;
+
+        Compression::IDecompressor* decompressor = nullptr;
+        if (input.substr(0, s_ZlibFormatMarker.size()) == s_ZlibFormatMarker)
+        {
+            thread_local Compression::ZlibDecompressor t_zlibDecompressor;
+            input.remove_prefix(s_ZlibFormatMarker.size());
+            decompressor = &t_zlibDecompressor;
+        }
+        else
+        {
+            thread_local Compression::Decompressor t_decompressor = CreateDecompressor();
+            decompressor = &t_decompressor;
+        }
+
+        decompressor->Decompress(input, t_buffer);
+        Deserialize(t_buffer);
+
+        // Don't hold on to the memory from an unusually large manifest.
+        if (t_buffer.capacity() > s_MaximumRetainedDecompressionBuffer)
+        {
+            t_buffer = {};
+        }
+    }
 }
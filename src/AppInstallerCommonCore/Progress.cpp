@@ -152,4 +152,82 @@ namespace AppInstaller
         m_rangeMin = rangeMin;
         m_rangeMax = rangeMax;
     }
+
+    ConcurrentProgressCallback::ConcurrentProgressCallback(IProgressCallback& baseCallback, size_t count) :
+        m_baseCallback(baseCallback)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            m_parts.emplace_back(std::make_unique<Part>(*this));
+        }
+
+        m_baseCancellation = m_baseCallback.SetCancellationFunction([this]() { CancelAll(); });
+    }
+
+    IProgressCallback& ConcurrentProgressCallback::operator[](size_t index)
+    {
+        return *m_parts.at(index);
+    }
+
+    void ConcurrentProgressCallback::ReportProgress()
+    {
+        uint64_t completed = 0;
+        for (const auto& part : m_parts)
+        {
+            completed += part->m_completed;
+        }
+
+        m_baseCallback.OnProgress(completed, m_parts.size() * 1000, ProgressType::Percent);
+    }
+
+    void ConcurrentProgressCallback::CancelAll()
+    {
+        std::lock_guard<std::mutex> lock{ m_lock };
+
+        for (const auto& part : m_parts)
+        {
+            if (part->m_partCancellationFunction)
+            {
+                part->m_partCancellationFunction();
+            }
+        }
+    }
+
+    void ConcurrentProgressCallback::Part::OnProgress(uint64_t current, uint64_t maximum, ProgressType)
+    {
+        if (!maximum)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock{ m_parent.m_lock };
+        m_completed = std::min(current, maximum) * 1000 / maximum;
+        m_parent.ReportProgress();
+    }
+
+    void ConcurrentProgressCallback::Part::SetProgressMessage(std::string_view message)
+    {
+        std::lock_guard<std::mutex> lock{ m_parent.m_lock };
+        m_parent.m_baseCallback.SetProgressMessage(message);
+    }
+
+    bool ConcurrentProgressCallback::Part::IsCancelledBy(CancelReason cancelReasons)
+    {
+        return m_parent.m_baseCallback.IsCancelledBy(cancelReasons);
+    }
+
+    IProgressCallback::CancelFunctionRemoval ConcurrentProgressCallback::Part::SetCancellationFunction(std::function<void()>&& f)
+    {
+        std::lock_guard<std::mutex> lock{ m_parent.m_lock };
+        m_partCancellationFunction = std::move(f);
+
+        if (m_partCancellationFunction)
+        {
+            return IProgressCallback::CancelFunctionRemoval(this);
+        }
+        else
+        {
+            return {};
+        }
+    }
 }
@@ -3,6 +3,7 @@
 #pragma once
 #include <AppInstallerErrors.h>
 #include <AppInstallerProgress.h>
+#include <winget/Filesystem.h>
 
 #include <chrono>
 #include <filesystem>
@@ -51,6 +52,9 @@ namespace AppInstaller::Utility
         std::vector<BYTE> Sha256Hash;
         uint64_t SizeInBytes = 0;
         std::optional<std::string> ContentType;
+        // The identity of the downloaded file, captured through the handle that wrote or hashed it before that handle was closed.
+        // Not set if there was no such handle, in which case the contents of the file are not known to match the hash.
+        std::optional<Filesystem::FileIdentity> FileIdentity;
     };
 
     // An exception that indicates that a remote service is too busy/unavailable and may contain data on when to try again.
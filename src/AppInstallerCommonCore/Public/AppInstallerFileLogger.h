@@ -5,6 +5,8 @@
 
 #include <filesystem>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 
@@ -22,13 +24,21 @@ namespace AppInstaller::Logging
         FileLogger(const FileLogger&) = delete;
         FileLogger& operator=(const FileLogger&) = delete;
 
-        FileLogger(FileLogger&&) = default;
-        FileLogger& operator=(FileLogger&&) = default;
+        FileLogger(FileLogger&&) = delete;
+        FileLogger& operator=(FileLogger&&) = delete;
 
         // The default value for the maximum size comes from settings.
         // Setting the maximum size to 0 will disable the maximum.
         FileLogger& SetMaximumSize(std::ofstream::off_type maximumSize);
 
+        // Writes logs to the file on a background thread, in batches, rather than on the logging thread.
+        // Errors and direct writes are still written immediately, after any logs that are waiting.
+        // Do not use for loggers that may be destroyed while the loader lock is held, as the thread is joined on destruction.
+        FileLogger& EnableBackgroundWriter();
+
+        // Writes any logs that are waiting for the background thread to the file.
+        void Flush() noexcept;
+
         static std::string GetNameForPath(const std::filesystem::path& filePath);
 
         static std::string_view DefaultPrefix();
@@ -48,19 +58,38 @@ namespace AppInstaller::Logging
         static void Add(const std::filesystem::path& filePath);
         static void Add(std::string_view fileNamePrefix);
 
+        // Adds a FileLogger with a background writer to the current Log
+        static void AddWithBackgroundWriter(std::string_view fileNamePrefix);
+
+        // Flushes every FileLogger in the process; for use when the process may be about to exit.
+        static void FlushAll() noexcept;
+
         // Starts a background task to clean up old log files.
         static void BeginCleanup();
         static void BeginCleanup(const std::filesystem::path& filePath);
 
     private:
+        struct BackgroundWriter;
+
         std::string m_name;
         std::filesystem::path m_filePath;
+        std::mutex m_streamLock;
         std::ofstream m_stream;
         std::ofstream::pos_type m_headersEnd = 0;
         std::ofstream::off_type m_maximumSize = 0;
+        std::unique_ptr<BackgroundWriter> m_backgroundWriter;
 
         void OpenFileLoggerStream();
 
+        // Writes a single line to the file; the stream lock must be held.
+        void WriteLine(std::string_view message);
+
+        // Writes the logs that are waiting for the background thread; the stream lock must be held.
+        void WriteQueuedLines();
+
+        // The body of the background thread.
+        void BackgroundWriterThread();
+
         // Initializes the default maximum file size.
         void InitializeDefaultMaximumFileSize();
 
@@ -4,7 +4,10 @@
 #include <wil/resource.h>
 #include <atomic>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <string_view>
+#include <vector>
 
 namespace AppInstaller
 {
@@ -137,6 +140,60 @@ namespace AppInstaller
         uint64_t m_globalMax = 0;
     };
 
+    // Splits a progress callback between operations that run concurrently.
+    // The progress of each operation is reported to the base callback as its share of the combined percentage,
+    // and cancellation of the base callback is forwarded to every operation.
+    struct ConcurrentProgressCallback
+    {
+        ConcurrentProgressCallback(IProgressCallback& baseCallback, size_t count);
+
+        ConcurrentProgressCallback(const ConcurrentProgressCallback&) = delete;
+        ConcurrentProgressCallback& operator=(const ConcurrentProgressCallback&) = delete;
+
+        ConcurrentProgressCallback(ConcurrentProgressCallback&&) = delete;
+        ConcurrentProgressCallback& operator=(ConcurrentProgressCallback&&) = delete;
+
+        // Gets the callback for the operation at the given index.
+        IProgressCallback& operator[](size_t index);
+
+    private:
+        struct Part : public ProgressCallback
+        {
+            Part(ConcurrentProgressCallback& parent) : m_parent(parent) {}
+
+            void BeginProgress() override {}
+
+            void OnProgress(uint64_t current, uint64_t maximum, ProgressType type) override;
+
+            void SetProgressMessage(std::string_view message) override;
+
+            void EndProgress(bool) override {}
+
+            bool IsCancelledBy(CancelReason cancelReasons) override;
+
+            [[nodiscard]] IProgressCallback::CancelFunctionRemoval SetCancellationFunction(std::function<void()>&& f) override;
+
+        private:
+            friend ConcurrentProgressCallback;
+
+            ConcurrentProgressCallback& m_parent;
+            std::function<void()> m_partCancellationFunction;
+            // The completed portion of this operation, in thousandths.
+            uint64_t m_completed = 0;
+        };
+
+        // Reports the combined progress of all parts; must be called with the lock held.
+        void ReportProgress();
+
+        // Calls the cancellation functions of all parts.
+        void CancelAll();
+
+        IProgressCallback& m_baseCallback;
+        std::mutex m_lock;
+        std::vector<std::unique_ptr<Part>> m_parts;
+        IProgressCallback::CancelFunctionRemoval m_baseCancellation;
+    };
+
     namespace details
     {
         inline void RemoveCancellationFunction(IProgressCallback* callback)
@@ -5,7 +5,9 @@
 #include <AppInstallerSHA256.h>
 #include <filesystem>
 #include <istream>
+#include <optional>
 #include <sstream>
+#include <string_view>
 
 namespace AppInstaller::Caching
 {
@@ -52,10 +54,27 @@ namespace AppInstaller::Caching
         // The hash must match for this function to return successfully.
         std::unique_ptr<std::istream> GetFile(const std::filesystem::path& relativePath, const Utility::SHA256::HashBuffer& expectedHash) const;
 
+        // Gets the contents of the requested file.
+        // The hash must match for this function to return successfully.
+        std::string GetFileContents(const std::filesystem::path& relativePath, const Utility::SHA256::HashBuffer& expectedHash) const;
+
+        // Gets contents derived from the requested file (such as a preprocessed form of it), if they were stored
+        // for a file with the expected hash. Derived contents are an optimization only and result in no value on any failure.
+        // They cannot be verified against the expected hash, so they are stored in a directory that only the current user can write to,
+        // rather than beside the cached file.
+        std::optional<std::string> GetDerivedContents(const std::filesystem::path& relativePath, const Utility::SHA256::HashBuffer& expectedHash, std::string_view derivedName) const;
+
+        // Stores contents derived from the requested file, keyed by the hash of the file they were derived from.
+        // Old entries, and the least recently written ones once the total size exceeds a fixed limit, are evicted.
+        void StoreDerivedContents(const std::filesystem::path& relativePath, const Utility::SHA256::HashBuffer& sourceHash, std::string_view derivedName, std::string_view contents) const;
+
     private:
+        // Gets the key for the given derived contents.
+        std::wstring GetDerivedContentsKey(const std::filesystem::path& relativePath, std::string_view derivedName) const;
+
         // Gets a stream containing the contents of the requested file from an upstream source.
         // The hash must match for this function to return successfully.
-        std::unique_ptr<std::stringstream> GetUpstreamFile(std::string relativePath, const Utility::SHA256::HashBuffer& expectedHash) const;
+        std::unique_ptr<std::istream> GetUpstreamFile(std::string relativePath, const Utility::SHA256::HashBuffer& expectedHash) const;
 
         Details m_details;
         std::vector<std::string> m_sources;
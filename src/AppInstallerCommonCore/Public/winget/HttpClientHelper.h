@@ -36,20 +36,43 @@ namespace AppInstaller::Http
 
         std::optional<web::json::value> HandleGet(const utility::string_t& uri, const HttpRequestHeaders& headers = {}, const HttpRequestHeaders& authHeaders = {}, const HttpResponseHandler& customHandler = {}) const;
 
+        // Same as HandlePost and HandleGet, but gets the UTF-8 body of the JSON response for callers that deserialize it themselves.
+        // A result from the custom handler is serialized.
+        std::optional<std::string> HandlePostForBody(const utility::string_t& uri, const web::json::value& body, const HttpRequestHeaders& headers = {}, const HttpRequestHeaders& authHeaders = {}, const HttpResponseHandler& customHandler = {}) const;
+
+        std::optional<std::string> HandleGetForBody(const utility::string_t& uri, const HttpRequestHeaders& headers = {}, const HttpRequestHeaders& authHeaders = {}, const HttpResponseHandler& customHandler = {}) const;
+
+        // Parses a UTF-8 JSON body without first widening it to UTF-16; an empty body is a null value.
+        static web::json::value ParseJsonBody(std::string_view body);
+
         void SetPinningConfiguration(const Certificates::PinningConfiguration& configuration, std::shared_ptr<ThreadLocalStorage::ThreadGlobals> threadGlobals = {});
 
     protected:
         std::optional<web::json::value> ValidateAndExtractResponse(const web::http::http_response& response) const;
 
+        std::optional<std::string> ValidateAndExtractBody(const web::http::http_response& response) const;
+
+        // Parses the UTF-8 body without first widening it to UTF-16.
         std::optional<web::json::value> ExtractJsonResponse(const web::http::http_response& response) const;
 
+        // Gets the UTF-8 body of a JSON response.
+        std::string ExtractJsonBody(const web::http::http_response& response) const;
+
     private:
-        web::http::client::http_client GetClient(const utility::string_t& uri) const;
+        // Logs and validates the response status; returns whether the response has a body to extract.
+        bool ValidateResponse(const web::http::http_response& response) const;
+
+        // Keeps clients alive per host so that requests can reuse connections; shared by copies of the helper.
+        struct ClientPool;
+
+        // Gets a client for the scheme and authority of the uri; requests should use the uri resource as their request uri.
+        web::http::client::http_client GetClient(const web::uri& uri) const;
 
         // Translates a cpprestsdk http_exception to a WIL exception.
         static void RethrowAsWilException(const web::http::http_exception& exception);
 
         std::shared_ptr<web::http::http_pipeline_stage> m_defaultRequestHandlerStage;
         web::http::client::http_client_config m_clientConfig;
+        std::shared_ptr<ClientPool> m_clientPool;
     };
 }
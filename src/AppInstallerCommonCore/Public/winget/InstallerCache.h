@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <AppInstallerSHA256.h>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+namespace AppInstaller::Caching
+{
+    // A content-addressed cache of installer files, keyed by their SHA256 hash, so that the same bytes are only downloaded once
+    // regardless of which package refers to them. The directory may be shared between users or machines, so entries are always
+    // hashed again when they are taken out of the cache. The least recently used entries are evicted to stay within the maximum size.
+    struct InstallerCache
+    {
+        InstallerCache(std::filesystem::path directory, uint64_t maximumSizeInBytes);
+
+        // Creates the cache configured by the user settings, or returns an empty value if the cache is disabled.
+        static std::optional<InstallerCache> CreateFromUserSettings();
+
+        // Gets the directory of the cache.
+        const std::filesystem::path& GetDirectory() const;
+
+        // Copies the installer with the given hash to the target path if it is in the cache.
+        // Returns the hash details of the copy if it was found and its hash matches.
+        std::optional<Utility::SHA256::HashDetails> TryGet(const Utility::SHA256::HashBuffer& hash, const std::filesystem::path& target) const;
+
+        // Adds a copy of the file, whose hash has been verified to be the given hash, to the cache.
+        // Failures are logged but otherwise ignored.
+        void Add(const Utility::SHA256::HashBuffer& hash, const std::filesystem::path& file) const;
+
+    private:
+        // Gets the path to the cache entry for the given hash.
+        std::filesystem::path GetEntryPath(const Utility::SHA256::HashBuffer& hash) const;
+
+        // Removes the least recently used entries until the cache fits within its maximum size.
+        void Evict() const;
+
+        std::filesystem::path m_directory;
+        uint64_t m_maximumSizeInBytes;
+    };
+}
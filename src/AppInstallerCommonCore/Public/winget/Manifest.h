@@ -7,6 +7,8 @@
 #include <winget/ManifestInstaller.h>
 #include <winget/ManifestLocalization.h>
 
+#include <functional>
+#include <memory>
 #include <vector>
 
 namespace AppInstaller::Manifest
@@ -38,8 +40,26 @@ namespace AppInstaller::Manifest
 
         // ApplyLocale will update the CurrentLocalization according to the specified locale
         // If locale is empty, user setting locale will be used
+        // Localizations that are not yet populated (see ManifestValidateOption::DeferLocalizations) are considered,
+        // but only the selected one is populated.
         void ApplyLocale(const std::string& locale = {});
 
+        // Adds a localization that is only populated when it is first needed.
+        void AddDeferredLocalization(string_t locale, std::function<ManifestLocalization()> populate);
+
+        // Gets whether there are localizations that have not been populated into Localizations.
+        bool HasDeferredLocalizations() const { return !m_deferredLocalizations.empty(); }
+
+        // Populates all deferred localizations and moves them into Localizations.
+        void MaterializeLocalizations();
+
+        // Invokes the callback on every additional localization, including deferred ones.
+        // Use this instead of Localizations when the manifest may have been created with deferred localizations.
+        void ForEachLocalization(const std::function<void(const ManifestLocalization&)>& callback) const;
+
+        // Gets the locale of every additional localization, including deferred ones, without populating them.
+        std::vector<string_t> GetLocalizationLocales() const;
+
         // Get all tags across localizations
         std::vector<string_t> GetAggregatedTags() const;
 
@@ -68,6 +88,10 @@ namespace AppInstaller::Manifest
         Utility::SHA256::HashBuffer StreamSha256;
 
     private:
+        struct DeferredLocalization;
+
+        std::vector<std::shared_ptr<DeferredLocalization>> m_deferredLocalizations;
+
         std::vector<string_t> GetSystemReferenceStrings(
             std::function<const string_t& (const ManifestInstaller&)> extractStringFromInstaller = {},
             std::function<const string_t& (const AppsAndFeaturesEntry&)> extractStringFromAppsAndFeaturesEntry = {}) const;
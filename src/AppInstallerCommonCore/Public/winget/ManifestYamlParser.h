@@ -36,6 +36,18 @@ namespace AppInstaller::Manifest::YamlParser
         ManifestValidateOption validateOption = {},
         const std::filesystem::path& mergedManifestPath = {});
 
+    // Creates a manifest from the input as Create does, also outputting the parsed document in the binary form
+    // used by CreateFromBinary so that later loads can skip parsing the YAML.
+    Manifest CreateWithBinary(
+        const std::string& input,
+        std::string& binaryOut,
+        ManifestValidateOption validateOption = {});
+
+    // Creates a manifest from the binary form output by CreateWithBinary.
+    Manifest CreateFromBinary(
+        std::string_view input,
+        ManifestValidateOption validateOption = {});
+
     Manifest ParseManifest(
         std::vector<YamlManifestInfo>& input,
         ManifestValidateOption validateOption = {},
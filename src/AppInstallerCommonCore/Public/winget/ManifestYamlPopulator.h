@@ -138,6 +138,16 @@ namespace AppInstaller::Manifest
         std::vector<ValidationError> ProcessDSC_PowerShellResourcesNode(const YAML::Node& node, DesiredStateConfigurationContainerInfo* container);
         std::vector<ValidationError> ProcessDSCv3ResourcesNode(const YAML::Node& node, DesiredStateConfigurationContainerInfo* container);
 
+        // Defers the population of the localization node if possible; returns false if it must be populated now.
+        bool TryDeferLocalization(const YAML::Node& localizationNode);
+
+        // Populates a single localization node that was deferred during manifest population.
+        static ManifestLocalization PopulateDeferredLocalization(
+            const YAML::Node& localizationNode,
+            const ManifestVer& manifestVersion,
+            ManifestValidateOption validateOption,
+            bool isMergedManifest);
+
         std::vector<ValidationError> PopulateManifestInternal();
         std::vector<ValidationError> InsertShadow(const YAML::Node& shadowNode);
     };
@@ -11,6 +11,15 @@ namespace AppInstaller::Manifest
     // Contains the manifest that stores package version data for index v2
     struct PackageVersionDataManifest
     {
+        // The formats that the compressed manifest can be stored in.
+        enum class CompressionFormat
+        {
+            // The MSZIP format of the Windows Compression API; this is what is written to indexes.
+            MSZip,
+            // A format marker followed by a zlib stream, which does not depend on the Windows Compression API.
+            Zlib,
+        };
+
         // The file name to use for the package version data manifest.
         static std::string_view VersionManifestFileName();
 
@@ -26,6 +35,9 @@ namespace AppInstaller::Manifest
         // Creates the decompressor used by the PackageVersionDataManifest.
         static Compression::Decompressor CreateDecompressor();
 
+        // Compresses the serialized manifest into the given format.
+        static std::vector<uint8_t> Compress(std::string_view serialized, CompressionFormat format = CompressionFormat::MSZip);
+
         // Data on an individual version.
         struct VersionData
         {
@@ -60,6 +72,9 @@ namespace AppInstaller::Manifest
         // Parses the input into this objects data.
         void Deserialize(const std::vector<uint8_t>& input);
 
+        // Decompresses the input with the decompressor for its format, then parses it into this objects data.
+        void DeserializeCompressed(std::string_view input);
+
     private:
         std::vector<VersionData> m_versions;
     };
@@ -96,6 +96,7 @@ namespace AppInstaller::Settings
         EnableSixelDisplay,
         // Source
         AutoUpdateTimeInMinutes,
+        SourceUpdateInBackground,
         // Experimental
         EFExperimentalCmd,
         EFExperimentalArg,
@@ -125,6 +126,8 @@ namespace AppInstaller::Settings
         NetworkDownloader,
         NetworkDOProgressTimeoutInSeconds,
         NetworkWingetAlternateSourceURL,
+        NetworkHttpClientPoolSize,
+        NetworkHttpClientIdleTimeoutInSeconds,
         // Logging
         LoggingLevelPreference,
         LoggingChannelPreference,
@@ -137,6 +140,8 @@ namespace AppInstaller::Settings
         UninstallPurgePortablePackage,
         // Download behavior
         DownloadDefaultDirectory,
+        InstallerCacheDirectory,
+        InstallerCacheMaximumSizeInMB,
         // Configure behavior
         ConfigureDefaultModuleRoot,
         // Interactivity
@@ -188,6 +193,7 @@ namespace AppInstaller::Settings
         SETTINGMAPPING_SPECIALIZATION(Setting::EnableSixelDisplay, bool, bool, false, ".visual.enableSixels"sv);
         // Source
         SETTINGMAPPING_SPECIALIZATION_POLICY(Setting::AutoUpdateTimeInMinutes, uint32_t, std::chrono::minutes, 15min, ".source.autoUpdateIntervalInMinutes"sv, ValuePolicy::SourceAutoUpdateIntervalInMinutes);
+        SETTINGMAPPING_SPECIALIZATION(Setting::SourceUpdateInBackground, bool, bool, false, ".source.updateInBackground"sv);
         // Experimental
         SETTINGMAPPING_SPECIALIZATION(Setting::EFExperimentalCmd, bool, bool, false, ".experimentalFeatures.experimentalCmd"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::EFExperimentalArg, bool, bool, false, ".experimentalFeatures.experimentalArg"sv);
@@ -217,6 +223,8 @@ namespace AppInstaller::Settings
         SETTINGMAPPING_SPECIALIZATION(Setting::UninstallPurgePortablePackage, bool, bool, false, ".uninstallBehavior.purgePortablePackage"sv);
         // Download behavior
         SETTINGMAPPING_SPECIALIZATION(Setting::DownloadDefaultDirectory, std::string, std::filesystem::path, {}, ".downloadBehavior.defaultDownloadDirectory"sv);
+        SETTINGMAPPING_SPECIALIZATION(Setting::InstallerCacheDirectory, std::string, std::filesystem::path, {}, ".downloadBehavior.installerCache.directory"sv);
+        SETTINGMAPPING_SPECIALIZATION(Setting::InstallerCacheMaximumSizeInMB, uint32_t, uint32_t, 0, ".downloadBehavior.installerCache.maximumSizeInMB"sv);
         // Configure behavior
         SETTINGMAPPING_SPECIALIZATION(Setting::ConfigureDefaultModuleRoot, std::string, std::filesystem::path, {}, ".configureBehavior.defaultModuleRoot"sv);
 
@@ -224,6 +232,8 @@ namespace AppInstaller::Settings
         SETTINGMAPPING_SPECIALIZATION(Setting::NetworkDownloader, std::string, InstallerDownloader, InstallerDownloader::Default, ".network.downloader"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::NetworkDOProgressTimeoutInSeconds, uint32_t, std::chrono::seconds, 60s, ".network.doProgressTimeoutInSeconds"sv);
         SETTINGMAPPING_SPECIALIZATION(Setting::NetworkWingetAlternateSourceURL, bool, bool, true, ".network.enableWingetAlternateSourceURL"sv);
+        SETTINGMAPPING_SPECIALIZATION(Setting::NetworkHttpClientPoolSize, uint32_t, uint32_t, 8, ".network.httpClientPoolSize"sv);
+        SETTINGMAPPING_SPECIALIZATION(Setting::NetworkHttpClientIdleTimeoutInSeconds, uint32_t, std::chrono::seconds, 90s, ".network.httpClientIdleTimeoutInSeconds"sv);
 #ifndef AICLI_DISABLE_TEST_HOOKS
         // Debug
         SETTINGMAPPING_SPECIALIZATION(Setting::EnableSelfInitiatedMinidump, bool, bool, false, ".debugging.enableSelfInitiatedMinidump"sv);
@@ -282,6 +282,7 @@ namespace AppInstaller::Settings
         }
 
         WINGET_VALIDATE_PASS_THROUGH(EnableSixelDisplay)
+        WINGET_VALIDATE_PASS_THROUGH(SourceUpdateInBackground)
         WINGET_VALIDATE_PASS_THROUGH(EFExperimentalCmd)
         WINGET_VALIDATE_PASS_THROUGH(EFExperimentalArg)
         WINGET_VALIDATE_PASS_THROUGH(EFDirectMSI)
@@ -295,7 +296,9 @@ namespace AppInstaller::Settings
         WINGET_VALIDATE_PASS_THROUGH(DisableInstallNotes)
         WINGET_VALIDATE_PASS_THROUGH(UninstallPurgePortablePackage)
         WINGET_VALIDATE_PASS_THROUGH(NetworkWingetAlternateSourceURL)
+        WINGET_VALIDATE_PASS_THROUGH(NetworkHttpClientPoolSize)
         WINGET_VALIDATE_PASS_THROUGH(MaxResumes)
+        WINGET_VALIDATE_PASS_THROUGH(InstallerCacheMaximumSizeInMB)
         WINGET_VALIDATE_PASS_THROUGH(LoggingFileTotalSizeLimitInMB)
         WINGET_VALIDATE_PASS_THROUGH(LoggingFileIndividualSizeLimitInMB)
         WINGET_VALIDATE_PASS_THROUGH(LoggingFileCountLimit)
@@ -422,6 +425,11 @@ namespace AppInstaller::Settings
             return ValidatePathValue(value);
         }
 
+        WINGET_VALIDATE_SIGNATURE(InstallerCacheDirectory)
+        {
+            return ValidatePathValue(value);
+        }
+
         WINGET_VALIDATE_SIGNATURE(ConfigureDefaultModuleRoot)
         {
             return ValidatePathValue(value);
@@ -454,6 +462,11 @@ namespace AppInstaller::Settings
             return std::chrono::seconds(value);
         }
 
+        WINGET_VALIDATE_SIGNATURE(NetworkHttpClientIdleTimeoutInSeconds)
+        {
+            return std::chrono::seconds(value);
+        }
+
         WINGET_VALIDATE_SIGNATURE(LoggingLevelPreference)
         {
             // logging preference possible values
@@ -177,15 +177,15 @@ namespace AppInstaller::Repository::Correlation
             AppInstaller::Manifest::Manifest::string_t defaultName = manifest.DefaultLocalization.Get<Localization::PackageName>();
             manifestSearchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::NormalizedNameAndPublisher, MatchType::Exact, defaultName, defaultPublisher));
 
-            for (const auto& loc : manifest.Localizations)
-            {
-                if (loc.Contains(Localization::PackageName) || loc.Contains(Localization::Publisher))
+            manifest.ForEachLocalization([&](const AppInstaller::Manifest::ManifestLocalization& loc)
                 {
-                    manifestSearchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::NormalizedNameAndPublisher, MatchType::Exact,
-                        loc.Contains(Localization::PackageName) ? loc.Get<Localization::PackageName>() : defaultName,
-                        loc.Contains(Localization::Publisher) ? loc.Get<Localization::Publisher>() : defaultPublisher));
-                }
-            }
+                    if (loc.Contains(Localization::PackageName) || loc.Contains(Localization::Publisher))
+                    {
+                        manifestSearchRequest.Inclusions.emplace_back(PackageMatchFilter(PackageMatchField::NormalizedNameAndPublisher, MatchType::Exact,
+                            loc.Contains(Localization::PackageName) ? loc.Get<Localization::PackageName>() : defaultName,
+                            loc.Contains(Localization::Publisher) ? loc.Get<Localization::Publisher>() : defaultPublisher));
+                    }
+                });
         }
 
         std::set<std::string> productCodes;
@@ -128,16 +128,16 @@ namespace AppInstaller::Repository::Correlation
             WordSequence defaultName = NormalizeAndPrepareName(manifest.DefaultLocalization.Get<Manifest::Localization::PackageName>());
             m_namesAndPublishers.emplace_back(defaultName, defaultPublisher);
 
-            for (const auto& loc : manifest.Localizations)
-            {
-                if (loc.Contains(Manifest::Localization::PackageName) || loc.Contains(Manifest::Localization::Publisher))
+            manifest.ForEachLocalization([&](const Manifest::ManifestLocalization& loc)
                 {
-                    auto name = loc.Contains(Manifest::Localization::PackageName) ? NormalizeAndPrepareName(loc.Get<Manifest::Localization::PackageName>()) : defaultName;
-                    auto publisher = loc.Contains(Manifest::Localization::Publisher) ? NormalizeAndPreparePublisher(loc.Get<Manifest::Localization::Publisher>()) : defaultPublisher;
+                    if (loc.Contains(Manifest::Localization::PackageName) || loc.Contains(Manifest::Localization::Publisher))
+                    {
+                        auto name = loc.Contains(Manifest::Localization::PackageName) ? NormalizeAndPrepareName(loc.Get<Manifest::Localization::PackageName>()) : defaultName;
+                        auto publisher = loc.Contains(Manifest::Localization::Publisher) ? NormalizeAndPreparePublisher(loc.Get<Manifest::Localization::Publisher>()) : defaultPublisher;
 
-                    m_namesAndPublishers.emplace_back(std::move(name), std::move(publisher));
-                }
-            }
+                        m_namesAndPublishers.emplace_back(std::move(name), std::move(publisher));
+                    }
+                });
         }
     }
 
@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "CompositeSource.h"
 #include <winget/ExperimentalFeature.h>
+#include <winget/Timing.h>
 
 using namespace AppInstaller::Settings;
 
@@ -417,9 +418,10 @@ namespace AppInstaller::Repository
                     std::shared_ptr<IPackageVersion> trackingPackageVersion;
                     if (m_trackingPackage)
                     {
-                        // Remove our use of the package id as source
+                        // Remove the installed source and package, which the tracking package does not know about
                         PackageVersionKey versionKey_NoSource = versionKey;
                         versionKey_NoSource.SourceId.clear();
+                        versionKey_NoSource.InstalledPackageId.reset();
 
                         trackingPackageVersion = m_trackingPackage->GetVersion(versionKey_NoSource);
 
@@ -564,7 +566,7 @@ namespace AppInstaller::Repository
 
         private:
             // Contains information about all of the version keys.
-            // We use the `SourceId` field to store the installed package identifier so that we can disambiguate keys is they have the same version.
+            // The `InstalledPackageId` field disambiguates keys if they have the same version.
             struct VersionKeyData : public PackageVersionKey
             {
                 size_t PackageIndex;
@@ -591,7 +593,7 @@ namespace AppInstaller::Repository
                 }
 
                 size_t packageIndex = m_packages.size();
-                std::string packageIdentifier = package->GetProperty(PackageProperty::Id);
+                auto packageIdentifier = std::make_shared<const std::string>(package->GetProperty(PackageProperty::Id).get());
                 bool versionAdded = false;
 
                 for (const auto& versionKey : package->GetVersionKeys())
@@ -603,12 +605,11 @@ namespace AppInstaller::Repository
 
                     if (!keyData.InstalledVersion)
                     {
-                        AICLI_LOG(Repo, Verbose, << "AddPackageAndVersionKeyData: Package [" << packageIdentifier << "] did not return a version for [" << versionKey.Version << "]");
+                        AICLI_LOG(Repo, Verbose, << "AddPackageAndVersionKeyData: Package [" << *packageIdentifier << "] did not return a version for [" << versionKey.Version << "]");
                         continue;
                     }
 
-                    // We use the `SourceId` field to store the installed package identifier so that we can disambiguate keys if they have the same version.
-                    keyData.SourceId = packageIdentifier;
+                    keyData.InstalledPackageId = packageIdentifier;
 
                     keyData.InstalledType = Manifest::ConvertToInstallerTypeEnum(keyData.InstalledVersion->GetMetadata()[PackageVersionMetadata::InstalledType]);
                     if (m_availablePackageVersionOverride && Manifest::DoesInstallerTypeSupportArpVersionRange(keyData.InstalledType))
@@ -1421,6 +1422,7 @@ namespace AppInstaller::Repository
     {
         if (m_installedSource)
         {
+            Timing::ScopedTimer timer{ Timing::Phase::Correlation };
             return SearchInstalled(request);
         }
         else
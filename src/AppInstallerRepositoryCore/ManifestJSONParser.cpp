@@ -87,6 +87,12 @@ namespace AppInstaller::Repository::JSON
         return m_pImpl->m_deserializer->Deserialize(response);
     }
 
+    std::vector<Manifest::Manifest> ManifestJSONParser::Deserialize(const web::json::value& response, std::string_view version, std::string_view channel) const
+    {
+        Rest::Schema::V1_0::Json::ManifestVersionFilter filter{ version, channel };
+        return m_pImpl->m_deserializer->Deserialize(response, &filter);
+    }
+
     std::vector<Manifest::Manifest> ManifestJSONParser::DeserializeData(const web::json::value& data) const
     {
         return m_pImpl->m_deserializer->DeserializeData(data);
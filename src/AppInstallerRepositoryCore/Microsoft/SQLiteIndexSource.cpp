@@ -7,6 +7,7 @@
 #include "Microsoft/PreIndexedPackageSourceFactory.h"
 #include <winget/ManifestYamlParser.h>
 #include <winget/PackageVersionDataManifest.h>
+#include <winget/Timing.h>
 
 using namespace AppInstaller::Utility;
 
@@ -66,6 +67,7 @@ namespace AppInstaller::Repository::Microsoft
 
     SearchResult SQLiteIndexSource::Search(const SearchRequest& request) const
     {
+        Timing::ScopedTimer timer{ Timing::Phase::Search };
         auto indexResults = m_index.Search(request);
 
         SearchResult result;
@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "Microsoft/SQLiteIndexSourceV1.h"
 #include <winget/ManifestYamlParser.h>
+#include <winget/Timing.h>
 
 using namespace AppInstaller::Utility;
 
@@ -60,8 +61,12 @@ namespace AppInstaller::Repository::Microsoft::details::V1
                 manifestSHA256 = SHA256::ConvertToBytes(manifestHashString.value());
             }
 
+            Timing::ScopedTimer fetchTimer{ Timing::Phase::ManifestFetch };
             std::unique_ptr<std::istream> manifestStream = m_manifestCache->GetFile(ConvertToUTF16(relativePathOpt.value()), manifestSHA256);
-            return Manifest::YamlParser::Create(ReadEntireStream(*manifestStream));
+            std::string manifestContents = ReadEntireStream(*manifestStream);
+            fetchTimer.Stop();
+
+            return Manifest::YamlParser::Create(manifestContents);
         }
 
         Source GetSource() const override
@@ -3,12 +3,16 @@
 #include "pch.h"
 #include "Microsoft/SQLiteIndexSourceV2.h"
 #include <winget/ManifestYamlParser.h>
+#include <winget/Timing.h>
 
 using namespace AppInstaller::Utility;
 
 
 namespace AppInstaller::Repository::Microsoft::details::V2
 {
+    // The name of the derived cache contents that hold the parsed form of a manifest.
+    constexpr std::string_view s_ManifestBinaryDerivedName = "ybin";
+
     // Get the relative path and hash for the package version data manifest.
     std::pair<std::filesystem::path, std::string> CreatePackageVersionDataRelativePath(const std::shared_ptr<SQLiteIndexSource>& source, SQLiteIndex::IdType packageRowId)
     {
@@ -25,11 +29,10 @@ namespace AppInstaller::Repository::Microsoft::details::V2
     Manifest::PackageVersionDataManifest GetPackageVersionData(const std::shared_ptr<SQLiteIndexSource>& source, SQLiteIndex::IdType packageRowId, const Caching::FileCache& fileCache)
     {
         auto pathAndHash = CreatePackageVersionDataRelativePath(source, packageRowId);
-        auto fileStream = fileCache.GetFile(pathAndHash.first, SHA256::ConvertToBytes(pathAndHash.second));
-        auto fileBytes = ReadEntireStreamAsByteArray(*fileStream);
+        std::string fileContents = fileCache.GetFileContents(pathAndHash.first, SHA256::ConvertToBytes(pathAndHash.second));
 
         Manifest::PackageVersionDataManifest result;
-        result.Deserialize(Manifest::PackageVersionDataManifest::CreateDecompressor().Decompress(fileBytes));
+        result.DeserializeCompressed(fileContents);
 
         return result;
     }
@@ -226,9 +229,41 @@ namespace AppInstaller::Repository::Microsoft::details::V2
                 return;
             }
 
-            std::unique_ptr<std::istream> manifestStream =
-                m_manifestCache->GetFile(ConvertToUTF16(m_packageVersionData->ManifestRelativePath), SHA256::ConvertToBytes(m_packageVersionData->ManifestHash));
-            m_manifest = Manifest::YamlParser::Create(ReadEntireStream(*manifestStream));
+            // Only the localization selected for the user is needed up front; the rest are populated on demand.
+            Manifest::ManifestValidateOption validateOption;
+            validateOption.DeferLocalizations = true;
+
+            std::filesystem::path manifestRelativePath = ConvertToUTF16(m_packageVersionData->ManifestRelativePath);
+            SHA256::HashBuffer manifestHash = SHA256::ConvertToBytes(m_packageVersionData->ManifestHash);
+
+            // Prefer the already parsed form of the manifest when one was stored for this hash.
+            Timing::ScopedTimer binaryFetchTimer{ Timing::Phase::ManifestFetch };
+            std::optional<std::string> manifestBinary = m_manifestCache->GetDerivedContents(manifestRelativePath, manifestHash, s_ManifestBinaryDerivedName);
+            binaryFetchTimer.Stop();
+            if (manifestBinary)
+            {
+                try
+                {
+                    m_manifest = Manifest::YamlParser::CreateFromBinary(manifestBinary.value(), validateOption);
+                }
+                catch (...)
+                {
+                    LOG_CAUGHT_EXCEPTION_MSG("Failed to load the cached binary manifest, falling back to the YAML");
+                }
+            }
+
+            if (!m_manifest)
+            {
+                Timing::ScopedTimer fetchTimer{ Timing::Phase::ManifestFetch };
+                std::unique_ptr<std::istream> manifestStream = m_manifestCache->GetFile(manifestRelativePath, manifestHash);
+                std::string manifestContents = ReadEntireStream(*manifestStream);
+                fetchTimer.Stop();
+
+                std::string newManifestBinary;
+                m_manifest = Manifest::YamlParser::CreateWithBinary(manifestContents, newManifestBinary, validateOption);
+                m_manifestCache->StoreDerivedContents(manifestRelativePath, manifestHash, s_ManifestBinaryDerivedName, newManifestBinary);
+            }
+
             m_manifest->ApplyLocale();
         }
 
@@ -378,10 +413,7 @@ namespace AppInstaller::Repository::Microsoft::details::V2
                 intermediate = m_manifest->GetPublishers();
                 break;
             case PackageVersionMultiProperty::Locale:
-                for (const auto& localization : m_manifest->Localizations)
-                {
-                    intermediate.emplace_back(localization.Locale);
-                }
+                intermediate = m_manifest->GetLocalizationLocales();
                 break;
             case PackageVersionMultiProperty::Tag:
                 intermediate = m_manifest->GetAggregatedTags();
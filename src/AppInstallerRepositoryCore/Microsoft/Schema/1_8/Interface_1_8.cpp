@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Microsoft/Schema/1_8/Interface.h"
+#include "Microsoft/Schema/1_8/VersionSortKeyVirtualTable.h"
+#include "Microsoft/Schema/1_0/ChannelTable.h"
+#include "Microsoft/Schema/1_0/IdTable.h"
+#include "Microsoft/Schema/1_0/ManifestTable.h"
+#include "Microsoft/Schema/1_0/VersionTable.h"
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_8
+{
+    namespace
+    {
+        SQLite::blob_t GetVersionSortKey(const Manifest::Manifest& manifest)
+        {
+            return Utility::Version{ manifest.Version }.GetSortKey();
+        }
+    }
+
+    Interface::Interface(Utility::NormalizationVersion normVersion) : V1_7::Interface(normVersion)
+    {
+    }
+
+    SQLite::Version Interface::GetVersion() const
+    {
+        return { 1, 8 };
+    }
+
+    void Interface::CreateTables(SQLite::Connection& connection, CreateOptions options)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "createtables_v1_8");
+
+        V1_7::Interface::CreateTables(connection, options);
+
+        V1_0::ManifestTable::AddColumn(connection, { VersionSortKeyVirtualTable::ValueName(), VersionSortKeyVirtualTable::SQLiteType() });
+
+        savepoint.Commit();
+    }
+
+    SQLite::rowid_t Interface::AddManifest(SQLite::Connection& connection, const Manifest::Manifest& manifest, const std::optional<std::filesystem::path>& relativePath)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "addmanifest_v1_8");
+
+        SQLite::rowid_t manifestId = V1_7::Interface::AddManifest(connection, manifest, relativePath);
+
+        V1_0::ManifestTable::UpdateValueIdById<VersionSortKeyVirtualTable>(connection, manifestId, GetVersionSortKey(manifest));
+
+        savepoint.Commit();
+
+        return manifestId;
+    }
+
+    std::pair<bool, SQLite::rowid_t> Interface::UpdateManifest(SQLite::Connection& connection, const Manifest::Manifest& manifest, const std::optional<std::filesystem::path>& relativePath)
+    {
+        SQLite::Savepoint savepoint = SQLite::Savepoint::Create(connection, "updatemanifest_v1_8");
+
+        auto [indexModified, manifestId] = V1_7::Interface::UpdateManifest(connection, manifest, relativePath);
+
+        // The version may have changed casing, which does not change the sort key, but keep it in sync regardless
+        SQLite::blob_t sortKey = GetVersionSortKey(manifest);
+        std::optional<SQLite::blob_t> currentSortKey = V1_0::ManifestTable::GetIdById<VersionSortKeyVirtualTable>(connection, manifestId);
+
+        if (!currentSortKey || currentSortKey.value() != sortKey)
+        {
+            V1_0::ManifestTable::UpdateValueIdById<VersionSortKeyVirtualTable>(connection, manifestId, sortKey);
+            indexModified = true;
+        }
+
+        savepoint.Commit();
+
+        return { indexModified, manifestId };
+    }
+
+    std::vector<ISQLiteIndex::VersionKey> Interface::GetVersionKeysById(const SQLite::Connection& connection, SQLite::rowid_t id) const
+    {
+        using QCol = SQLite::Builder::QualifiedColumn;
+
+        std::string_view manifestTable = V1_0::ManifestTable::TableName();
+        std::string_view versionTable = V1_0::VersionTable::TableName();
+        std::string_view channelTable = V1_0::ChannelTable::TableName();
+
+        // Let the database order the versions by their sort keys, which order the same as parsing and comparing them would.
+        // This matches the VersionAndChannel ordering; channels ascending and versions descending within each channel.
+        SQLite::Builder::StatementBuilder builder;
+        builder.Select({
+            QCol(manifestTable, SQLite::RowIDName),
+            QCol(versionTable, V1_0::VersionTable::ValueName()),
+            QCol(channelTable, V1_0::ChannelTable::ValueName()) }).
+            From(manifestTable).
+            Join(versionTable).On(QCol(manifestTable, V1_0::VersionTable::ValueName()), QCol(versionTable, SQLite::RowIDName)).
+            Join(channelTable).On(QCol(manifestTable, V1_0::ChannelTable::ValueName()), QCol(channelTable, SQLite::RowIDName)).
+            Where(QCol(manifestTable, V1_0::IdTable::ValueName())).Equals(id).
+            OrderBy({ QCol(channelTable, V1_0::ChannelTable::ValueName()), QCol(manifestTable, VersionSortKeyVirtualTable::ValueName()) }).Descending();
+
+        SQLite::Statement select = builder.Prepare(connection);
+
+        std::vector<ISQLiteIndex::VersionKey> result;
+        while (select.Step())
+        {
+            auto [manifestId, version, channel] = select.GetRow<SQLite::rowid_t, std::string, std::string>();
+            result.emplace_back(ISQLiteIndex::VersionKey{ Utility::VersionAndChannel{ Utility::Version{ std::move(version) }, Utility::Channel{ std::move(channel) } }, manifestId });
+        }
+
+        return result;
+    }
+
+    bool Interface::HasVersionSortKeys(const SQLite::Connection& connection)
+    {
+        SQLite::Statement select = SQLite::Statement::Create(connection, "SELECT COUNT(*) FROM pragma_table_info(?) WHERE name = ?");
+        select.Bind(1, V1_0::ManifestTable::TableName());
+        select.Bind(2, VersionSortKeyVirtualTable::ValueName());
+
+        return select.Step() && select.GetColumn<int>(0) != 0;
+    }
+}
@@ -0,0 +1,32 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <winget/SQLiteStatementBuilder.h>
+
+#include <string_view>
+
+using namespace std::string_view_literals;
+
+
+namespace AppInstaller::Repository::Microsoft::Schema::V1_8
+{
+    // A virtual table used to add a direct column onto the manifest table.
+    // The value is the sort key of the manifest version, allowing versions to be ordered by the database.
+    struct VersionSortKeyVirtualTable
+    {
+        // The id type (which is actually the value for this virtual table)
+        using id_t = SQLite::blob_t;
+
+        // The name of the column.
+        static constexpr std::string_view ValueName()
+        {
+            return "version_sort_key"sv;
+        }
+
+        // The value type of the column.
+        static constexpr SQLite::Builder::Type SQLiteType()
+        {
+            return SQLite::Builder::Type::Blob;
+        }
+    };
+}
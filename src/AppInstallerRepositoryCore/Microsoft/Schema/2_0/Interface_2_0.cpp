@@ -3,6 +3,7 @@
 #include "pch.h"
 #include <winget/SQLiteMetadataTable.h>
 #include "Microsoft/Schema/2_0/Interface.h"
+#include "Microsoft/Schema/1_8/Interface.h"
 
 #include "Microsoft/Schema/2_0/PackagesTable.h"
 
@@ -387,8 +388,9 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
     {
         THROW_HR_IF_NULL(E_POINTER, current);
 
+        // The 1.N tables are kept as they are and become the internal tables, so migrating from 1.8 keeps the version sort keys.
         auto currentVersion = current->GetVersion();
-        if (currentVersion.MajorVersion != 1 || currentVersion.MinorVersion != 7)
+        if (currentVersion.MajorVersion != 1 || (currentVersion.MinorVersion != 7 && currentVersion.MinorVersion != 8))
         {
             return false;
         }
@@ -772,7 +774,8 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
         {
             if (!PackagesTable::Exists(connection))
             {
-                m_internalInterface = CreateInternalInterface();
+                // Indexes created or migrated before the internal schema moved to 1.8 do not have version sort keys.
+                m_internalInterface = V1_8::Interface::HasVersionSortKeys(connection) ? CreateInternalInterface() : CreateISQLiteIndex({ 1, 7 });
             }
 
             m_internalInterfaceChecked = true;
@@ -783,6 +786,6 @@ namespace AppInstaller::Repository::Microsoft::Schema::V2_0
 
     std::unique_ptr<Schema::ISQLiteIndex> Interface::CreateInternalInterface() const
     {
-        return CreateISQLiteIndex({ 1, 7 });
+        return CreateISQLiteIndex({ 1, 8 });
     }
 }
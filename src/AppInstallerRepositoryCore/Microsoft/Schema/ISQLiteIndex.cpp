@@ -11,6 +11,7 @@
 #include "Microsoft/Schema/1_5/Interface.h"
 #include "Microsoft/Schema/1_6/Interface.h"
 #include "Microsoft/Schema/1_7/Interface.h"
+#include "Microsoft/Schema/1_8/Interface.h"
 #include "Microsoft/Schema/2_0/Interface.h"
 
 namespace AppInstaller::Repository::Microsoft::Schema
@@ -30,7 +31,7 @@ namespace AppInstaller::Repository::Microsoft::Schema
         if (version.MajorVersion == 1 ||
             version.IsLatest())
         {
-            constexpr std::array<std::unique_ptr<ISQLiteIndex>(*)(), 8> versionCreatorMap =
+            constexpr std::array<std::unique_ptr<ISQLiteIndex>(*)(), 9> versionCreatorMap =
             {
                 []() { return std::unique_ptr<ISQLiteIndex>(std::make_unique<V1_0::Interface>()); },
                 []() { return std::unique_ptr<ISQLiteIndex>(std::make_unique<V1_1::Interface>()); },
@@ -40,6 +41,7 @@ namespace AppInstaller::Repository::Microsoft::Schema
                 []() { return std::unique_ptr<ISQLiteIndex>(std::make_unique<V1_5::Interface>()); },
                 []() { return std::unique_ptr<ISQLiteIndex>(std::make_unique<V1_6::Interface>()); },
                 []() { return std::unique_ptr<ISQLiteIndex>(std::make_unique<V1_7::Interface>()); },
+                []() { return std::unique_ptr<ISQLiteIndex>(std::make_unique<V1_8::Interface>()); },
             };
 
             return versionCreatorMap[std::min(static_cast<size_t>(version.MinorVersion), versionCreatorMap.size() - 1)]();
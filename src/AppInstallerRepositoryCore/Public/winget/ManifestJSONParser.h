@@ -6,6 +6,7 @@
 #include <winget/Manifest.h>
 
 #include <memory>
+#include <string_view>
 #include <vector>
 
 namespace AppInstaller::Repository::JSON
@@ -27,6 +28,10 @@ namespace AppInstaller::Repository::JSON
         // May potentially contain multiple versions of the same package.
         std::vector<Manifest::Manifest> Deserialize(const web::json::value& response) const;
 
+        // Deserializes only the manifest with the given version and channel from the REST response object root.
+        // Versions that do not match are skipped before their contents are parsed.
+        std::vector<Manifest::Manifest> Deserialize(const web::json::value& response, std::string_view version, std::string_view channel) const;
+
         // Deserializes the manifests from the Data field of the REST response object.
         // May potentially contain multiple versions of the same package.
         std::vector<Manifest::Manifest> DeserializeData(const web::json::value& data) const;
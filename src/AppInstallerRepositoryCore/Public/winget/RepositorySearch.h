@@ -257,6 +257,10 @@ namespace AppInstaller::Repository
         // The source id that this version came from.
         std::string SourceId;
 
+        // When installed packages are combined into one, the identifier of the installed package that this version came from.
+        // This disambiguates keys that have the same version; the keys of a package share one copy.
+        std::shared_ptr<const std::string> InstalledPackageId;
+
         // The version.
         Utility::NormalizedString Version;
 
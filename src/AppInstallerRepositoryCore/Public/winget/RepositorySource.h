@@ -10,6 +10,7 @@
 
 #include <chrono>
 #include <filesystem>
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
@@ -345,6 +346,8 @@ namespace AppInstaller::Repository
         /* Source operations */
 
         // Opens the source. This function should throw upon open failure rather than returning an empty pointer.
+        // If the user has enabled updating in the background, sources with existing data are opened as is and
+        // updated on another thread; the last copy of this object to be destroyed waits for that update to finish.
         std::vector<SourceDetails> Open(IProgressCallback& progress);
 
         // Add source. Source add command.
@@ -385,5 +388,7 @@ namespace AppInstaller::Repository
         std::optional<TimeSpan> m_backgroundUpdateInterval;
         bool m_installedPackageInformationOnly = false;
         mutable std::shared_ptr<PackageTrackingCatalog> m_trackingCatalog;
+        std::shared_ptr<ThreadLocalStorage::ThreadGlobals> m_threadGlobals;
+        std::shared_ptr<std::future<void>> m_backgroundUpdate;
     };
 }
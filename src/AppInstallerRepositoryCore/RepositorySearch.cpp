@@ -98,6 +98,7 @@ namespace AppInstaller::Repository
     {
         return
             ((other.SourceId.empty() || other.SourceId == SourceId) &&
+             (!other.InstalledPackageId || (InstalledPackageId && *other.InstalledPackageId == *InstalledPackageId)) &&
              (other.Version.empty() || Utility::Version{ other.Version } == Utility::Version{ Version }) &&
              (other.Channel.empty() || Utility::ICUCaseInsensitiveEquals(other.Channel, Channel)));
     }
@@ -18,6 +18,9 @@
 #endif
 
 #include <winget/GroupPolicy.h>
+#include <winget/SharedThreadGlobals.h>
+#include <winget/Timing.h>
+#include <future>
 
 using namespace AppInstaller::Settings;
 using namespace std::chrono_literals;
@@ -62,6 +65,7 @@ namespace AppInstaller::Repository
         AddOrUpdateResult AddOrUpdateFromDetails(SourceDetails& details, MemberFunc member, IProgressCallback& progress)
         {
             AddOrUpdateResult result;
+            Timing::ScopedTimer timer{ Timing::Phase::SourceUpdate };
 
             auto factory = ISourceFactory::GetForType(details.Type);
 
@@ -140,6 +144,111 @@ namespace AppInstaller::Repository
             return AddOrUpdateFromDetails(details, &ISourceFactory::BackgroundUpdate, progress);
         }
 
+        // Runs the operation for each index concurrently, splitting the progress between them.
+        // Returns the result of each operation, or an empty value for those that threw; onException is called from within the catch block.
+        template <typename T, typename Operation, typename ExceptionHandler>
+        std::vector<std::optional<T>> RunForEachConcurrently(size_t count, IProgressCallback& progress, Operation&& operation, ExceptionHandler&& onException)
+        {
+            std::vector<std::optional<T>> results(count);
+
+            auto runOne = [&](size_t i, IProgressCallback& operationProgress)
+            {
+                try
+                {
+                    results[i] = operation(i, operationProgress);
+                }
+                catch (...)
+                {
+                    onException(i);
+                }
+            };
+
+            if (count <= 1)
+            {
+                if (count)
+                {
+                    runOne(0, progress);
+                }
+
+                return results;
+            }
+
+            ConcurrentProgressCallback concurrentProgress{ progress, count };
+            ThreadLocalStorage::ThreadGlobals* threadGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+            std::vector<std::future<void>> otherOperations;
+
+            for (size_t i = 1; i < count; ++i)
+            {
+                otherOperations.emplace_back(std::async(std::launch::async, [&, i]()
+                    {
+                        auto threadGlobalsCleanup = threadGlobals ? threadGlobals->SetForCurrentThread() : nullptr;
+                        runOne(i, concurrentProgress[i]);
+                    }));
+            }
+
+            // The first operation runs on this thread.
+            runOne(0, concurrentProgress[0]);
+
+            for (auto& otherOperation : otherOperations)
+            {
+                otherOperation.get();
+            }
+
+            return results;
+        }
+
+        // Determines whether the source has been updated before, and so has data that can be opened while it is updated again.
+        bool HasBeenUpdated(const SourceDetails& details)
+        {
+            return details.LastUpdateTime > Utility::ConvertUnixEpochToSystemClock(0);
+        }
+
+        // Updates the sources on another thread and saves their metadata once done.
+        // Each update takes the same cross process lock as a foreground update, and the source factories move
+        // the new data into place atomically; it is used by the next open of the source.
+        std::future<void> UpdateSourcesInBackground(std::vector<SourceDetails> sources, std::shared_ptr<ThreadLocalStorage::ThreadGlobals> threadGlobals)
+        {
+            return std::async(std::launch::async, [sources = std::move(sources), threadGlobals = std::move(threadGlobals)]() mutable
+                {
+                    auto threadGlobalsCleanup = threadGlobals ? threadGlobals->SetForCurrentThread() : nullptr;
+
+                    ProgressCallback progress;
+                    std::vector<std::optional<AddOrUpdateResult>> updateResults = RunForEachConcurrently<AddOrUpdateResult>(sources.size(), progress,
+                        [&](size_t i, IProgressCallback& updateProgress)
+                        {
+                            AICLI_LOG(Repo, Info, << "Updating source in the background: " << sources[i].Name);
+                            return BackgroundUpdateSourceFromDetails(sources[i], updateProgress);
+                        },
+                        [&](size_t i)
+                        {
+                            LOG_CAUGHT_EXCEPTION();
+                            AICLI_LOG(Repo, Warning, << "Failed to update source in the background: " << sources[i].Name);
+                        });
+
+                    try
+                    {
+                        SourceList sourceList;
+
+                        for (size_t i = 0; i < sources.size(); ++i)
+                        {
+                            if (!updateResults[i] || !updateResults[i]->MetadataWritten)
+                            {
+                                continue;
+                            }
+
+                            // The source may have been removed while it was being updated.
+                            auto detailsInternal = sourceList.GetSource(sources[i].Name);
+                            if (detailsInternal)
+                            {
+                                detailsInternal->CopyMetadataFieldsFrom(sources[i]);
+                                sourceList.SaveMetadata(*detailsInternal);
+                            }
+                        }
+                    }
+                    CATCH_LOG_MSG("Failed to save source metadata after background update");
+                });
+        }
+
         bool RemoveSourceFromDetails(const SourceDetails& details, IProgressCallback& progress)
         {
             auto factory = ISourceFactory::GetForType(details.Type);
@@ -697,6 +806,8 @@ namespace AppInstaller::Repository
 
     void Source::SetThreadGlobals(const std::shared_ptr<ThreadLocalStorage::ThreadGlobals>& threadGlobals)
     {
+        m_threadGlobals = threadGlobals;
+
         for (auto& sourceReference : m_sourceReferences)
         {
             sourceReference->SetThreadGlobals(threadGlobals);
@@ -802,6 +913,7 @@ namespace AppInstaller::Repository
             std::vector<std::shared_ptr<ISourceReference>>* sourceReferencesToOpen = nullptr;
             std::vector<std::shared_ptr<ISourceReference>> sourceReferencesForTrackingOnly;
             std::unique_ptr<SourceList> sourceList;
+            std::vector<SourceDetails> sourcesToUpdateInBackground;
 
             if (m_installedPackageInformationOnly)
             {
@@ -816,43 +928,75 @@ namespace AppInstaller::Repository
             else
             {
                 // Check for updates before opening.
+                bool updateInBackground = Settings::User().Get<Settings::Setting::SourceUpdateInBackground>();
+                std::vector<SourceDetails*> sourcesToUpdate;
                 for (auto& sourceReference : m_sourceReferences)
                 {
                     if (ShouldUpdateBeforeOpen(sourceReference.get(), m_backgroundUpdateInterval))
                     {
-                        auto& details = sourceReference->GetDetails();
+                        SourceDetails& details = sourceReference->GetDetails();
 
-                        try
+                        // A source with existing data can be opened as is, leaving the update for later invocations.
+                        if (updateInBackground && HasBeenUpdated(details))
                         {
-                            // TODO: Consider adding a context callback to indicate we are doing the same action
-                            // to avoid the progress bar fill up multiple times.
-                            AddOrUpdateResult updateResult = BackgroundUpdateSourceFromDetails(details, progress);
+                            sourcesToUpdateInBackground.emplace_back(details);
+                        }
+                        else
+                        {
+                            sourcesToUpdate.emplace_back(&details);
+                        }
+                    }
+                }
 
-                            if (updateResult.MetadataWritten)
-                            {
-                                if (sourceList == nullptr)
-                                {
-                                    sourceList = std::make_unique<SourceList>();
-                                }
-
-                                auto detailsInternal = sourceList->GetSource(details.Name);
-                                detailsInternal->CopyMetadataFieldsFrom(details);
-                                sourceList->SaveMetadata(*detailsInternal);
-                            }
+                // The sources are updated concurrently; the metadata is saved afterward as the source list is not thread safe.
+                std::vector<std::optional<AddOrUpdateResult>> updateResults = RunForEachConcurrently<AddOrUpdateResult>(sourcesToUpdate.size(), progress,
+                    [&](size_t i, IProgressCallback& updateProgress)
+                    {
+                        return BackgroundUpdateSourceFromDetails(*sourcesToUpdate[i], updateProgress);
+                    },
+                    [&](size_t i)
+                    {
+                        LOG_CAUGHT_EXCEPTION();
+                        AICLI_LOG(Repo, Warning, << "Failed to update source: " << sourcesToUpdate[i]->Name);
+                    });
+
+                for (size_t i = 0; i < sourcesToUpdate.size(); ++i)
+                {
+                    auto& details = *sourcesToUpdate[i];
+                    auto& updateResult = updateResults[i];
 
-                            if (!updateResult.UpdateChecked)
+                    if (!updateResult)
+                    {
+                        result.emplace_back(details);
+                        continue;
+                    }
+
+                    try
+                    {
+                        if (updateResult->MetadataWritten)
+                        {
+                            if (sourceList == nullptr)
                             {
-                                AICLI_LOG(Repo, Error, << "Failed to update source: " << details.Name);
-                                result.emplace_back(details);
+                                sourceList = std::make_unique<SourceList>();
                             }
+
+                            auto detailsInternal = sourceList->GetSource(details.Name);
+                            detailsInternal->CopyMetadataFieldsFrom(details);
+                            sourceList->SaveMetadata(*detailsInternal);
                         }
-                        catch (...)
+
+                        if (!updateResult->UpdateChecked)
                         {
-                            LOG_CAUGHT_EXCEPTION();
-                            AICLI_LOG(Repo, Warning, << "Failed to update source: " << details.Name);
+                            AICLI_LOG(Repo, Error, << "Failed to update source: " << details.Name);
                             result.emplace_back(details);
                         }
                     }
+                    catch (...)
+                    {
+                        LOG_CAUGHT_EXCEPTION();
+                        AICLI_LOG(Repo, Warning, << "Failed to update source: " << details.Name);
+                        result.emplace_back(details);
+                    }
                 }
 
                 sourceReferencesToOpen = &m_sourceReferences;
@@ -863,21 +1007,37 @@ namespace AppInstaller::Repository
                 AICLI_LOG(Repo, Info, << "Multiple sources available, creating aggregated source.");
                 auto aggregatedSource = std::make_shared<CompositeSource>("*DefaultSource");
                 std::vector<std::shared_ptr<OpenExceptionProxy>> openExceptionProxies;
+                std::vector<std::exception_ptr> openExceptions(sourceReferencesToOpen->size());
 
-                for (auto& sourceReference : *sourceReferencesToOpen)
-                {
-                    AICLI_LOG(Repo, Info, << "Adding to aggregated source: " << sourceReference->GetDetails().Name);
+                // The sources are opened concurrently, but added to the aggregated source in their configured order.
+                std::vector<std::optional<std::shared_ptr<ISource>>> openedSources = RunForEachConcurrently<std::shared_ptr<ISource>>(sourceReferencesToOpen->size(), progress,
+                    [&](size_t i, IProgressCallback& openProgress)
+                    {
+                        AICLI_LOG(Repo, Info, << "Adding to aggregated source: " << (*sourceReferencesToOpen)[i]->GetDetails().Name);
+                        Timing::ScopedTimer timer{ Timing::Phase::SourceOpen };
+                        return (*sourceReferencesToOpen)[i]->Open(openProgress);
+                    },
+                    [&](size_t i)
+                    {
+                        LOG_CAUGHT_EXCEPTION();
+                        AICLI_LOG(Repo, Warning, << "Failed to open available source: " << (*sourceReferencesToOpen)[i]->GetDetails().Name);
+                        openExceptions[i] = std::current_exception();
+                    });
 
+                for (size_t i = 0; i < openedSources.size(); ++i)
+                {
                     try
-
                     {
-                        aggregatedSource->AddAvailableSource(sourceReference->Open(progress));
+                        if (!openedSources[i])
+                        {
+                            std::rethrow_exception(openExceptions[i]);
+                        }
+
+                        aggregatedSource->AddAvailableSource(std::move(openedSources[i]).value());
                     }
                     catch (...)
                     {
-                        LOG_CAUGHT_EXCEPTION();
-                        AICLI_LOG(Repo, Warning, << "Failed to open available source: " << sourceReference->GetDetails().Name);
-                        openExceptionProxies.emplace_back(std::make_shared<OpenExceptionProxy>(sourceReference->GetDetails(), std::current_exception()));
+                        openExceptionProxies.emplace_back(std::make_shared<OpenExceptionProxy>((*sourceReferencesToOpen)[i]->GetDetails(), std::current_exception()));
                     }
                 }
 
@@ -894,8 +1054,14 @@ namespace AppInstaller::Repository
             }
             else
             {
+                Timing::ScopedTimer timer{ Timing::Phase::SourceOpen };
                 m_source = (*sourceReferencesToOpen)[0]->Open(progress);
             }
+
+            if (!sourcesToUpdateInBackground.empty())
+            {
+                m_backgroundUpdate = std::make_shared<std::future<void>>(UpdateSourcesInBackground(std::move(sourcesToUpdateInBackground), m_threadGlobals));
+            }
         }
 
         return result;
@@ -0,0 +1,387 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "RestResponseCache.h"
+#include <AppInstallerDateTime.h>
+#include <AppInstallerRuntime.h>
+#include <AppInstallerSynchronization.h>
+#include <winget/Filesystem.h>
+#include <winget/JsonUtil.h>
+
+namespace AppInstaller::Repository::Rest
+{
+    namespace
+    {
+        constexpr std::wstring_view s_ETagName = L"etag"sv;
+        constexpr std::wstring_view s_ExpirationName = L"expiration"sv;
+
+        constexpr std::wstring_view s_ETagHeader = L"ETag"sv;
+        constexpr std::wstring_view s_IfNoneMatchHeader = L"If-None-Match"sv;
+
+        // Calculates the cache key from everything that can change the response.
+        Utility::SHA256::HashBuffer GetKey(std::string_view method, const utility::string_t& uri, const web::json::value* body, const Http::HttpClientHelper::HttpRequestHeaders& headers)
+        {
+            std::stringstream stream;
+            stream << method << '|' << utility::conversions::to_utf8string(uri) << '|';
+
+            if (body)
+            {
+                body->serialize(stream);
+            }
+
+            // Order the headers so that the key does not depend on the map iteration order.
+            std::map<utility::string_t, utility::string_t> orderedHeaders{ headers.begin(), headers.end() };
+            for (const auto& header : orderedHeaders)
+            {
+                stream << '|' << utility::conversions::to_utf8string(header.first) << ':' << utility::conversions::to_utf8string(header.second);
+            }
+
+            return Utility::SHA256::ComputeHash(stream);
+        }
+
+        uint64_t CalculateExpiration(const Utility::CacheControlPolicy& cacheControl)
+        {
+            if (cacheControl.NoCache)
+            {
+                // Always revalidate
+                return 0;
+            }
+
+            return static_cast<uint64_t>(Utility::ConvertSystemClockToUnixEpoch(std::chrono::system_clock::now() + std::chrono::seconds{ cacheControl.MaxAge }));
+        }
+
+        std::optional<web::json::value> ParseBody(const std::optional<std::string>& body)
+        {
+            if (!body)
+            {
+                return {};
+            }
+
+            return Http::HttpClientHelper::ParseJsonBody(body.value());
+        }
+    }
+
+    RestResponseCache::RestResponseCache() : RestResponseCache(Runtime::GetPathTo(Runtime::PathName::Temp) / "cache" / "Rest") {}
+
+    RestResponseCache::RestResponseCache(std::filesystem::path directory, uint64_t maximumSizeInBytes) :
+        m_maximumSizeInBytes(maximumSizeInBytes)
+    {
+        try
+        {
+            // Items are not verified when read, so no one but the current user (and the system) may change them.
+            Filesystem::PathDetails details;
+            details.Path = std::move(directory);
+            details.SetOwner(Filesystem::ACEPrincipal::CurrentUser);
+            details.ACL[Filesystem::ACEPrincipal::System] = Filesystem::ACEPermissions::All;
+            details.ACL[Filesystem::ACEPrincipal::Admins] = Filesystem::ACEPermissions::All;
+            m_directory = Filesystem::InitializeAndGetPathTo(std::move(details));
+        }
+        catch (...)
+        {
+            LOG_CAUGHT_EXCEPTION_MSG("RestResponseCache failed to secure its directory; responses will not be cached");
+            m_directory.clear();
+        }
+    }
+
+    std::optional<web::json::value> RestResponseCache::HandleGet(
+        const Http::HttpClientHelper& helper,
+        const utility::string_t& uri,
+        const Http::HttpClientHelper::HttpRequestHeaders& headers,
+        const Http::HttpClientHelper::HttpRequestHeaders& authHeaders,
+        const Http::HttpClientHelper::HttpResponseHandler& customHandler) const
+    {
+        if (!authHeaders.empty())
+        {
+            return helper.HandleGet(uri, headers, authHeaders, customHandler);
+        }
+
+        return ParseBody(Handle(GetKey("GET", uri, nullptr, headers), headers, customHandler,
+            [&](const Http::HttpClientHelper::HttpRequestHeaders& requestHeaders, const Http::HttpClientHelper::HttpResponseHandler& handler)
+            {
+                return helper.HandleGetForBody(uri, requestHeaders, authHeaders, handler);
+            }));
+    }
+
+    std::optional<web::json::value> RestResponseCache::HandlePost(
+        const Http::HttpClientHelper& helper,
+        const utility::string_t& uri,
+        const web::json::value& body,
+        const Http::HttpClientHelper::HttpRequestHeaders& headers,
+        const Http::HttpClientHelper::HttpRequestHeaders& authHeaders,
+        const Http::HttpClientHelper::HttpResponseHandler& customHandler) const
+    {
+        if (!authHeaders.empty())
+        {
+            return helper.HandlePost(uri, body, headers, authHeaders, customHandler);
+        }
+
+        return ParseBody(HandlePostForBody(helper, uri, body, headers, authHeaders, customHandler));
+    }
+
+    std::optional<std::string> RestResponseCache::HandlePostForBody(
+        const Http::HttpClientHelper& helper,
+        const utility::string_t& uri,
+        const web::json::value& body,
+        const Http::HttpClientHelper::HttpRequestHeaders& headers,
+        const Http::HttpClientHelper::HttpRequestHeaders& authHeaders,
+        const Http::HttpClientHelper::HttpResponseHandler& customHandler) const
+    {
+        if (!authHeaders.empty())
+        {
+            return helper.HandlePostForBody(uri, body, headers, authHeaders, customHandler);
+        }
+
+        return Handle(GetKey("POST", uri, &body, headers), headers, customHandler,
+            [&](const Http::HttpClientHelper::HttpRequestHeaders& requestHeaders, const Http::HttpClientHelper::HttpResponseHandler& handler)
+            {
+                return helper.HandlePostForBody(uri, body, requestHeaders, authHeaders, handler);
+            });
+    }
+
+    std::optional<std::string> RestResponseCache::Handle(
+        const Utility::SHA256::HashBuffer& key,
+        const Http::HttpClientHelper::HttpRequestHeaders& headers,
+        const Http::HttpClientHelper::HttpResponseHandler& customHandler,
+        const SendRequest& sendRequest) const
+    {
+        std::optional<CacheItem> cachedItem = Read(key);
+
+        if (cachedItem && std::chrono::system_clock::now() < Utility::ConvertUnixEpochToSystemClock(cachedItem->UnixEpochExpiration))
+        {
+            AICLI_LOG(Repo, Verbose, << "RestResponseCache using cached response");
+            return std::move(cachedItem->Body);
+        }
+
+        Http::HttpClientHelper::HttpRequestHeaders requestHeaders = headers;
+        if (cachedItem)
+        {
+            requestHeaders.insert_or_assign(utility::string_t{ s_IfNoneMatchHeader }, cachedItem->ETag);
+        }
+
+        bool notModified = false;
+        bool storable = false;
+        Utility::CacheControlPolicy cacheControl;
+        utility::string_t etag;
+
+        std::optional<std::string> result = sendRequest(requestHeaders,
+            [&](const web::http::http_response& response) -> Http::HttpClientHelper::HttpResponseHandlerResult
+            {
+                if (cachedItem && response.status_code() == web::http::status_codes::NotModified)
+                {
+                    notModified = true;
+                    cacheControl = Utility::CacheControlPolicy{ response.headers().cache_control() };
+                    response.headers().match(utility::string_t{ s_ETagHeader }, etag);
+                    return { std::nullopt, false };
+                }
+
+                if (response.status_code() == web::http::status_codes::OK)
+                {
+                    storable = true;
+                    cacheControl = Utility::CacheControlPolicy{ response.headers().cache_control() };
+                    response.headers().match(utility::string_t{ s_ETagHeader }, etag);
+                }
+
+                if (customHandler)
+                {
+                    return customHandler(response);
+                }
+
+                return { std::nullopt, true };
+            });
+
+        if (notModified)
+        {
+            AICLI_LOG(Repo, Verbose, << "RestResponseCache revalidated cached response");
+
+            if (!etag.empty())
+            {
+                cachedItem->ETag = std::move(etag);
+            }
+
+            cachedItem->UnixEpochExpiration = CalculateExpiration(cacheControl);
+            Write(key, cachedItem.value());
+            result = std::move(cachedItem->Body);
+        }
+        else if (storable && result && !cacheControl.NoStore && (cacheControl.MaxAge || !etag.empty()))
+        {
+            CacheItem item;
+            item.ETag = std::move(etag);
+            item.UnixEpochExpiration = CalculateExpiration(cacheControl);
+            item.Body = result.value();
+            Write(key, item);
+        }
+
+        return result;
+    }
+
+    std::optional<RestResponseCache::CacheItem> RestResponseCache::Read(const Utility::SHA256::HashBuffer& key) const try
+    {
+        if (m_directory.empty())
+        {
+            return std::nullopt;
+        }
+
+        std::filesystem::path itemPath = GetItemPath(key);
+        std::ifstream stream{ itemPath, std::ios_base::in | std::ios_base::binary };
+
+        if (!stream)
+        {
+            return std::nullopt;
+        }
+
+        std::string header;
+        std::getline(stream, header);
+        web::json::value headerValue = Http::HttpClientHelper::ParseJsonBody(header);
+
+        CacheItem result;
+        result.UnixEpochExpiration = JSON::GetRawUInt64ValueFromJsonNode(headerValue, std::wstring{ s_ExpirationName }).value_or(0);
+        result.ETag = JSON::GetWideStringValueFromJsonNode(headerValue, std::wstring{ s_ETagName }).value_or(L"");
+        result.Body.assign(std::istreambuf_iterator<char>{ stream }, std::istreambuf_iterator<char>{});
+        stream.close();
+
+        bool expired = std::chrono::system_clock::now() >= Utility::ConvertUnixEpochToSystemClock(result.UnixEpochExpiration);
+
+        if (result.Body.empty() || (expired && result.ETag.empty()))
+        {
+            // Nothing can be done with this item, so remove it.
+            std::error_code error;
+            std::filesystem::remove(itemPath, error);
+            return std::nullopt;
+        }
+
+        return result;
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION_MSG("RestResponseCache::Read exception");
+        return std::nullopt;
+    }
+
+    void RestResponseCache::Write(const Utility::SHA256::HashBuffer& key, const CacheItem& item) const try
+    {
+        using namespace web::json;
+
+        if (m_directory.empty())
+        {
+            return;
+        }
+
+        // If another process is writing this item, it has a response at least as new as ours.
+        Synchronization::CrossProcessLock lock{ "WinGetRestResponseCache_" + Utility::SHA256::ConvertToString(key) };
+        if (!lock.TryAcquireNoWait())
+        {
+            return;
+        }
+
+        value headerValue = value::object();
+        object& headerObject = headerValue.as_object();
+
+        headerObject[std::wstring{ s_ETagName }] = value::value(item.ETag);
+        headerObject[std::wstring{ s_ExpirationName }] = value::value(item.UnixEpochExpiration);
+
+        std::filesystem::create_directories(m_directory);
+
+        // Write to the side and move into place so that readers never see a partial item.
+        std::filesystem::path itemPath = GetItemPath(key);
+        std::filesystem::path tempPath = itemPath;
+        tempPath += ".tmp";
+
+        {
+            std::ofstream stream{ tempPath, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary };
+            // The serialized header has no line breaks, so the body starts after the first one.
+            headerValue.serialize(stream);
+            stream << '\n';
+            stream.write(item.Body.data(), static_cast<std::streamsize>(item.Body.size()));
+        }
+
+        std::filesystem::rename(tempPath, itemPath);
+        AICLI_LOG(Repo, Verbose, << "RestResponseCache stored response");
+
+        lock.Release();
+        Evict();
+    }
+    CATCH_LOG_MSG("RestResponseCache::Write exception");
+
+    void RestResponseCache::Evict() const try
+    {
+        // Another process evicting will leave the cache within the limits as well.
+        Synchronization::CrossProcessLock lock{ "WinGetRestResponseCacheEviction" };
+        if (!lock.TryAcquireNoWait())
+        {
+            return;
+        }
+
+        struct ItemFile
+        {
+            std::filesystem::path Path;
+            uint64_t Size = 0;
+            std::filesystem::file_time_type LastWritten;
+        };
+
+        std::vector<ItemFile> itemFiles;
+        uint64_t totalSize = 0;
+        auto oldestAllowed = std::filesystem::file_time_type::clock::now() - MaximumItemAge;
+
+        for (const auto& directoryEntry : std::filesystem::directory_iterator{ m_directory })
+        {
+            if (!directoryEntry.is_regular_file())
+            {
+                continue;
+            }
+
+            ItemFile itemFile;
+            itemFile.Path = directoryEntry.path();
+            itemFile.LastWritten = directoryEntry.last_write_time();
+
+            // This also removes temporary files left behind by a failed write.
+            if (itemFile.LastWritten < oldestAllowed)
+            {
+                std::error_code error;
+                std::filesystem::remove(itemFile.Path, error);
+                continue;
+            }
+
+            // Anything else is an item being written.
+            if (itemFile.Path.extension() != L".item")
+            {
+                continue;
+            }
+
+            itemFile.Size = directoryEntry.file_size();
+            totalSize += itemFile.Size;
+            itemFiles.emplace_back(std::move(itemFile));
+        }
+
+        if (totalSize <= m_maximumSizeInBytes)
+        {
+            return;
+        }
+
+        std::sort(itemFiles.begin(), itemFiles.end(), [](const ItemFile& a, const ItemFile& b) { return a.LastWritten < b.LastWritten; });
+
+        for (const ItemFile& itemFile : itemFiles)
+        {
+            if (totalSize <= m_maximumSizeInBytes)
+            {
+                break;
+            }
+
+            std::error_code error;
+            if (std::filesystem::remove(itemFile.Path, error))
+            {
+                totalSize -= itemFile.Size;
+            }
+        }
+
+        AICLI_LOG(Repo, Verbose, << "RestResponseCache evicted items to stay within its maximum size");
+    }
+    CATCH_LOG_MSG("RestResponseCache::Evict exception");
+
+    std::filesystem::path RestResponseCache::GetItemPath(const Utility::SHA256::HashBuffer& key) const
+    {
+        std::filesystem::path result = m_directory;
+        result /= Utility::SHA256::ConvertToString(key);
+        result += ".item";
+        return result;
+    }
+}
@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <AppInstallerDownloader.h>
+#include <AppInstallerSHA256.h>
+#include <winget/HttpClientHelper.h>
+#include <cpprest/json.h>
+#include <chrono>
+#include <filesystem>
+#include <optional>
+
+namespace AppInstaller::Repository::Rest
+{
+    // A disk-backed cache of REST responses, shared across processes.
+    // Responses are reused while fresh according to their Cache-Control header, and revalidated with their ETag once stale.
+    // Requests with authentication headers are never cached.
+    // Items are used as stored, so the directory is restricted to the current user; if that fails, nothing is cached.
+    // An item is a line holding its ETag and expiration, followed by the response body exactly as received.
+    struct RestResponseCache
+    {
+        // The default limit on the total size of the items.
+        static constexpr uint64_t DefaultMaximumSizeInBytes = 50 * 1024 * 1024;
+
+        // Items that have not been written for this long are evicted, regardless of the total size.
+        static constexpr std::chrono::hours MaximumItemAge{ 7 * 24 };
+
+        // Creates a cache in the default location.
+        RestResponseCache();
+
+        // Creates a cache in the given directory; the least recently written items are evicted once the total size exceeds the maximum.
+        RestResponseCache(std::filesystem::path directory, uint64_t maximumSizeInBytes = DefaultMaximumSizeInBytes);
+
+        // Sends a GET request through the helper, or responds from the cache.
+        std::optional<web::json::value> HandleGet(
+            const Http::HttpClientHelper& helper,
+            const utility::string_t& uri,
+            const Http::HttpClientHelper::HttpRequestHeaders& headers = {},
+            const Http::HttpClientHelper::HttpRequestHeaders& authHeaders = {},
+            const Http::HttpClientHelper::HttpResponseHandler& customHandler = {}) const;
+
+        // Sends a POST request through the helper, or responds from the cache.
+        std::optional<web::json::value> HandlePost(
+            const Http::HttpClientHelper& helper,
+            const utility::string_t& uri,
+            const web::json::value& body,
+            const Http::HttpClientHelper::HttpRequestHeaders& headers = {},
+            const Http::HttpClientHelper::HttpRequestHeaders& authHeaders = {},
+            const Http::HttpClientHelper::HttpResponseHandler& customHandler = {}) const;
+
+        // Sends a POST request through the helper, or responds from the cache, with the UTF-8 body of the response.
+        std::optional<std::string> HandlePostForBody(
+            const Http::HttpClientHelper& helper,
+            const utility::string_t& uri,
+            const web::json::value& body,
+            const Http::HttpClientHelper::HttpRequestHeaders& headers = {},
+            const Http::HttpClientHelper::HttpRequestHeaders& authHeaders = {},
+            const Http::HttpClientHelper::HttpResponseHandler& customHandler = {}) const;
+
+    private:
+        struct CacheItem
+        {
+            utility::string_t ETag;
+            uint64_t UnixEpochExpiration = 0;
+            std::string Body;
+        };
+
+        using SendRequest = std::function<std::optional<std::string>(const Http::HttpClientHelper::HttpRequestHeaders&, const Http::HttpClientHelper::HttpResponseHandler&)>;
+
+        // Responds from the cache if possible, otherwise sends the request (conditionally if there is a stale item) and stores the response.
+        std::optional<std::string> Handle(
+            const Utility::SHA256::HashBuffer& key,
+            const Http::HttpClientHelper::HttpRequestHeaders& headers,
+            const Http::HttpClientHelper::HttpResponseHandler& customHandler,
+            const SendRequest& sendRequest) const;
+
+        // Reads the cache item for the key; a stale item is only returned if it can be revalidated.
+        std::optional<CacheItem> Read(const Utility::SHA256::HashBuffer& key) const;
+
+        // Writes the cache item for the key, unless another process is writing it.
+        void Write(const Utility::SHA256::HashBuffer& key, const CacheItem& item) const;
+
+        // Gets the path to the file holding the item for the key.
+        std::filesystem::path GetItemPath(const Utility::SHA256::HashBuffer& key) const;
+
+        // Removes old items, then the least recently written items until the cache is within its maximum size.
+        void Evict() const;
+
+        // Empty if the directory could not be restricted to the current user.
+        std::filesystem::path m_directory;
+        uint64_t m_maximumSizeInBytes = DefaultMaximumSizeInBytes;
+    };
+}
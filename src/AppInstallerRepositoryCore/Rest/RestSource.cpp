@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "RestSource.h"
 #include "MatchCriteriaResolver.h"
+#include <winget/Timing.h>
 
 using namespace AppInstaller::Utility;
 
@@ -382,8 +383,10 @@ namespace AppInstaller::Repository::Rest
                     return m_versionInfo.Manifest.value();
                 }
 
+                Timing::ScopedTimer timer{ Timing::Phase::ManifestFetch };
                 std::optional<Manifest::Manifest> manifest = GetReferenceSource()->GetRestClient().GetManifestByVersion(
                     m_package->PackageInfo().PackageIdentifier, m_versionInfo.VersionAndChannel.GetVersion().ToString(), m_versionInfo.VersionAndChannel.GetChannel().ToString());
+                timer.Stop();
 
                 if (!manifest)
                 {
@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 #pragma once
 #include "Rest/Schema/IRestClient.h"
+#include "Rest/RestResponseCache.h"
+#include "Rest/Schema/SearchResponseParser.h"
 #include <winget/HttpClientHelper.h>
 
 namespace AppInstaller::Repository::Rest::Schema::V1_0
@@ -28,14 +30,20 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
         IRestClient::SearchResult OptimizedSearch(const SearchRequest& request) const;
         IRestClient::SearchResult SearchInternal(const SearchRequest& request) const;
 
+        // Gets the manifests for the package; if a version is given, only the manifest matching version and channel is parsed and validated.
+        std::vector<Manifest::Manifest> GetManifestsInternal(const std::string& packageId, const std::map<std::string_view, std::string>& params, std::string_view version, std::string_view channel) const;
+
         // Check query params against source information and update if necessary.
         virtual std::map<std::string_view, std::string> GetValidatedQueryParams(const std::map<std::string_view, std::string>& params) const;
 
         // Check search request against source information and get json search body.
         virtual web::json::value GetValidatedSearchBody(const SearchRequest& searchRequest) const;
 
-        virtual SearchResult GetSearchResult(const web::json::value& searchResponseObject) const;
-        virtual std::vector<Manifest::Manifest> GetParsedManifests(const web::json::value& manifestsResponseObject) const;
+        // Gets the results from a parsed page of the search response.
+        virtual SearchResult GetSearchResult(SearchResponse&& searchResponse) const;
+
+        // Parses the manifests in the response; if a version is given, only the manifest matching version and channel is parsed.
+        virtual std::vector<Manifest::Manifest> GetParsedManifests(const web::json::value& manifestsResponseObject, std::string_view version = {}, std::string_view channel = {}) const;
 
         // Gets auth headers if source requires authentication for access.
         virtual Http::HttpClientHelper::HttpRequestHeaders GetAuthHeaders() const;
@@ -46,5 +54,6 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
         std::string m_restApiUri;
         utility::string_t m_searchEndpoint;
         Http::HttpClientHelper m_httpClientHelper;
+        RestResponseCache m_responseCache;
     };
 }
@@ -7,14 +7,26 @@
 
 namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
 {
+    // Limits deserialization to the version item with the given version and channel.
+    struct ManifestVersionFilter
+    {
+        std::string_view Version;
+        std::string_view Channel;
+
+        // Determines whether the given version and channel match the filter (case-insensitive).
+        bool IsMatch(std::string_view version, std::string_view channel) const;
+    };
+
     // Manifest Deserializer.
     struct ManifestDeserializer
     {
-        // Gets the manifest from the given json object received from a REST request
-        std::vector<Manifest::Manifest> Deserialize(const web::json::value& responseJsonObject) const;
+        // Gets the manifest from the given json object received from a REST request.
+        // If a filter is given, only the matching version is deserialized.
+        std::vector<Manifest::Manifest> Deserialize(const web::json::value& responseJsonObject, const ManifestVersionFilter* filter = nullptr) const;
 
-        // Gets the manifest from the given json Data field
-        std::vector<Manifest::Manifest> DeserializeData(const web::json::value& dataJsonObject) const;
+        // Gets the manifest from the given json Data field.
+        // If a filter is given, only the matching version is deserialized.
+        std::vector<Manifest::Manifest> DeserializeData(const web::json::value& dataJsonObject, const ManifestVersionFilter* filter = nullptr) const;
 
         // Deserializes the AppsAndFeaturesEntries node, returning the set of values below it.
         virtual std::vector<Manifest::AppsAndFeaturesEntry> DeserializeAppsAndFeaturesEntries(const web::json::array& entries) const;
@@ -98,7 +98,12 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
         }
     }
 
-    std::vector<Manifest::Manifest> ManifestDeserializer::Deserialize(const web::json::value& responseJsonObject) const
+    bool ManifestVersionFilter::IsMatch(std::string_view version, std::string_view channel) const
+    {
+        return Utility::CaseInsensitiveEquals(version, Version) && Utility::CaseInsensitiveEquals(channel, Channel);
+    }
+
+    std::vector<Manifest::Manifest> ManifestDeserializer::Deserialize(const web::json::value& responseJsonObject, const ManifestVersionFilter* filter) const
     {
         if (responseJsonObject.is_null())
         {
@@ -117,7 +122,7 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
                 return {};
             }
 
-            return DeserializeData(manifestObject.value());
+            return DeserializeData(manifestObject.value(), filter);
         }
         catch (const wil::ResultException&)
         {
@@ -137,7 +142,7 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
         THROW_HR(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA);
     }
 
-    std::vector<Manifest::Manifest> ManifestDeserializer::DeserializeData(const web::json::value& dataJsonObject) const
+    std::vector<Manifest::Manifest> ManifestDeserializer::DeserializeData(const web::json::value& dataJsonObject, const ManifestVersionFilter* filter) const
     {
         THROW_HR_IF(E_INVALIDARG, dataJsonObject.is_null());
 
@@ -175,6 +180,12 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
 
             manifest.Channel = JSON::GetRawStringValueFromJsonNode(versionItem, JSON::GetUtilityString(Channel)).value_or("");
 
+            // Skip the remainder of any version that was not requested; these can be the bulk of the response.
+            if (filter && !filter->IsMatch(manifest.Version, manifest.Channel))
+            {
+                continue;
+            }
+
             // Default locale
             std::optional<std::reference_wrapper<const web::json::value>> defaultLocale =
                 JSON::GetJsonValueFromNode(versionItem, JSON::GetUtilityString(DefaultLocale));
@@ -254,6 +265,11 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
             }
 
             manifests.emplace_back(std::move(manifest));
+
+            if (filter)
+            {
+                break;
+            }
         }
 
         return manifests;
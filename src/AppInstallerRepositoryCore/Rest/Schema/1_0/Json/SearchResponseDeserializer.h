@@ -1,19 +1,39 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 #pragma once
-#include <cpprest/json.h>
 #include "Rest/Schema/IRestClient.h"
+#include "Rest/Schema/SearchResponseParser.h"
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
 {
+    // The fields of a package version in a search response, as read from it.
+    struct SearchResponseVersionFields
+    {
+        std::optional<std::string> PackageVersion;
+        std::optional<std::string> Channel;
+        std::vector<std::string> PackageFamilyNames;
+        std::vector<std::string> ProductCodes;
+        std::vector<std::string> UpgradeCodes;
+        std::vector<std::string> AppsAndFeaturesEntryVersions;
+    };
+
     // Search Result Deserializer.
+    // The body is read as a stream of parse events, and each package is built as soon as it has been read.
     struct SearchResponseDeserializer
     {
-        // Gets the search result for given version
-        IRestClient::SearchResult Deserialize(const web::json::value& searchResultJsonObject) const;
+        virtual ~SearchResponseDeserializer() = default;
+
+        // Gets the search response from the UTF-8 body.
+        SearchResponse Deserialize(std::string_view searchResponseBody) const;
+
+        // Gets only the continuation token from the UTF-8 body, stopping once it has been read.
+        static std::string DeserializeContinuationToken(std::string_view searchResponseBody);
 
     protected:
-        virtual std::optional<IRestClient::SearchResult> DeserializeSearchResult(const web::json::value& searchResultJsonObject) const;
-        virtual std::optional<IRestClient::VersionInfo> DeserializeVersionInfo(const web::json::value& versionInfoJsonObject) const;
+        virtual std::optional<IRestClient::VersionInfo> DeserializeVersionInfo(SearchResponseVersionFields&& versionFields) const;
     };
 }
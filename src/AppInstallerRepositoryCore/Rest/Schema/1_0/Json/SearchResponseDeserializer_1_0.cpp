@@ -6,6 +6,7 @@
 #include "SearchResponseDeserializer.h"
 #include <winget/JsonUtil.h>
 #include <winget/Rest.h>
+#include <nlohmann/json.hpp>
 
 namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
 {
@@ -17,110 +18,407 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0::Json
         constexpr std::string_view Publisher = "Publisher"sv;
         constexpr std::string_view PackageFamilyNames = "PackageFamilyNames"sv;
         constexpr std::string_view ProductCodes = "ProductCodes"sv;
+        constexpr std::string_view UpgradeCodes = "UpgradeCodes"sv;
+        constexpr std::string_view AppsAndFeaturesEntryVersions = "AppsAndFeaturesEntryVersions"sv;
         constexpr std::string_view Versions = "Versions"sv;
         constexpr std::string_view PackageVersion = "PackageVersion"sv;
         constexpr std::string_view Channel = "Channel"sv;
-    }
+        constexpr std::string_view RequiredPackageMatchFields = "RequiredPackageMatchFields"sv;
+        constexpr std::string_view UnsupportedPackageMatchFields = "UnsupportedPackageMatchFields"sv;
 
-    IRestClient::SearchResult SearchResponseDeserializer::Deserialize(const web::json::value& searchResponseObject) const
-    {
-        std::optional<IRestClient::SearchResult> response = DeserializeSearchResult(searchResponseObject);
+        using Sax = nlohmann::json_sax<nlohmann::json>;
 
-        THROW_HR_IF(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA, !response);
+        // Builds the search response from the parse events of the body.
+        // Returning false from an event stops the parse, which is how invalid data is reported.
+        struct SearchResponseHandler : public Sax
+        {
+            using VersionInfoDeserializer = std::function<std::optional<IRestClient::VersionInfo>(SearchResponseVersionFields&&)>;
 
-        return response.value();
-    }
+            SearchResponseHandler(SearchResponse& response, VersionInfoDeserializer deserializeVersionInfo) :
+                m_response(response), m_deserializeVersionInfo(std::move(deserializeVersionInfo)) {}
 
-    std::optional<IRestClient::SearchResult> SearchResponseDeserializer::DeserializeSearchResult(const web::json::value& searchResponseObject) const
-    {
-        // Make search result from json output.
-        if (searchResponseObject.is_null())
-        {
-            AICLI_LOG(Repo, Error, << "Missing json object.");
-            return {};
-        }
+            bool null() override { return Value(nullptr); }
+            bool boolean(bool) override { return Value(nullptr); }
+            bool number_integer(number_integer_t) override { return Value(nullptr); }
+            bool number_unsigned(number_unsigned_t) override { return Value(nullptr); }
+            bool number_float(number_float_t, const string_t&) override { return Value(nullptr); }
+            bool string(string_t& value) override { return Value(&value); }
+            bool binary(binary_t&) override { return Value(nullptr); }
 
-        IRestClient::SearchResult result;
-        try
-        {
-            std::optional<std::reference_wrapper<const web::json::array>> dataArray = JSON::GetRawJsonArrayFromJsonNode(searchResponseObject, JSON::GetUtilityString(Data));
-            if (!dataArray || dataArray.value().get().size() == 0)
+            bool start_object(std::size_t) override
             {
-                AICLI_LOG(Repo, Verbose, << "No search results returned.");
-                return result;
+                Scope scope = Scope::Ignored;
+
+                if (m_scopes.empty())
+                {
+                    scope = Scope::Response;
+                }
+                else if (m_scopes.back() == Scope::Data)
+                {
+                    scope = Scope::Package;
+                    m_package = {};
+                }
+                else if (m_scopes.back() == Scope::Versions)
+                {
+                    scope = Scope::Version;
+                    m_version = {};
+                }
+
+                m_scopes.push_back(scope);
+                m_field = Field::None;
+                return true;
             }
 
-            for (auto& manifestItem : dataArray.value().get())
+            bool end_object() override
             {
-                std::optional<std::string> packageId = JSON::GetRawStringValueFromJsonNode(manifestItem, JSON::GetUtilityString(PackageIdentifier));
-                std::optional<std::string> packageName = JSON::GetRawStringValueFromJsonNode(manifestItem, JSON::GetUtilityString(PackageName));
-                std::optional<std::string> publisher = JSON::GetRawStringValueFromJsonNode(manifestItem, JSON::GetUtilityString(Publisher));
+                Scope scope = m_scopes.back();
+                m_scopes.pop_back();
 
-                if (!JSON::IsValidNonEmptyStringValue(packageId) || !JSON::IsValidNonEmptyStringValue(packageName) || !JSON::IsValidNonEmptyStringValue(publisher))
+                if (scope == Scope::Package)
+                {
+                    return AddPackage();
+                }
+                else if (scope == Scope::Version)
+                {
+                    return AddVersion();
+                }
+
+                return true;
+            }
+
+            bool start_array(std::size_t) override
+            {
+                if (m_scopes.empty())
+                {
+                    AICLI_LOG(Repo, Error, << "Search response is not an object.");
+                    return false;
+                }
+                else if (m_scopes.back() == Scope::Data)
                 {
                     AICLI_LOG(Repo, Error, << "Missing required package fields in manifest search results.");
-                    return {};
+                    return false;
+                }
+                else if (m_scopes.back() == Scope::Versions)
+                {
+                    AICLI_LOG(Repo, Error, << "Received incomplete package version");
+                    return false;
+                }
+
+                Scope scope = Scope::Ignored;
+
+                switch (m_field)
+                {
+                case Field::Data:
+                    scope = Scope::Data;
+                    break;
+                case Field::Versions:
+                    scope = Scope::Versions;
+                    break;
+                case Field::RequiredPackageMatchFields:
+                    scope = Scope::Strings;
+                    m_strings = &m_response.RequiredPackageMatchFields;
+                    break;
+                case Field::UnsupportedPackageMatchFields:
+                    scope = Scope::Strings;
+                    m_strings = &m_response.UnsupportedPackageMatchFields;
+                    break;
+                case Field::PackageFamilyNames:
+                    scope = Scope::Strings;
+                    m_strings = &m_version.PackageFamilyNames;
+                    break;
+                case Field::ProductCodes:
+                    scope = Scope::Strings;
+                    m_strings = &m_version.ProductCodes;
+                    break;
+                case Field::UpgradeCodes:
+                    scope = Scope::Strings;
+                    m_strings = &m_version.UpgradeCodes;
+                    break;
+                case Field::AppsAndFeaturesEntryVersions:
+                    scope = Scope::Strings;
+                    m_strings = &m_version.AppsAndFeaturesEntryVersions;
+                    break;
+                default:
+                    break;
+                }
+
+                m_scopes.push_back(scope);
+                m_field = Field::None;
+                return true;
+            }
+
+            bool end_array() override
+            {
+                m_scopes.pop_back();
+                return true;
+            }
+
+            bool key(string_t& name) override
+            {
+                m_field = Field::None;
+
+                switch (m_scopes.back())
+                {
+                case Scope::Response:
+                    if (name == Data) { m_field = Field::Data; }
+                    else if (name == ContinuationToken) { m_field = Field::ContinuationToken; }
+                    else if (name == RequiredPackageMatchFields) { m_field = Field::RequiredPackageMatchFields; }
+                    else if (name == UnsupportedPackageMatchFields) { m_field = Field::UnsupportedPackageMatchFields; }
+                    break;
+                case Scope::Package:
+                    if (name == PackageIdentifier) { m_field = Field::PackageIdentifier; }
+                    else if (name == PackageName) { m_field = Field::PackageName; }
+                    else if (name == Publisher) { m_field = Field::Publisher; }
+                    else if (name == Versions) { m_field = Field::Versions; }
+                    break;
+                case Scope::Version:
+                    if (name == PackageVersion) { m_field = Field::PackageVersion; }
+                    else if (name == Channel) { m_field = Field::Channel; }
+                    else if (name == PackageFamilyNames) { m_field = Field::PackageFamilyNames; }
+                    else if (name == ProductCodes) { m_field = Field::ProductCodes; }
+                    else if (name == UpgradeCodes) { m_field = Field::UpgradeCodes; }
+                    else if (name == AppsAndFeaturesEntryVersions) { m_field = Field::AppsAndFeaturesEntryVersions; }
+                    break;
+                default:
+                    break;
+                }
+
+                return true;
+            }
+
+            bool parse_error(std::size_t, const std::string&, const nlohmann::json::exception& exception) override
+            {
+                AICLI_LOG(Repo, Error, << "Error encountered while parsing search result. Reason: " << exception.what());
+                return false;
+            }
+
+        private:
+            enum class Scope
+            {
+                Response,
+                Data,
+                Package,
+                Versions,
+                Version,
+                Strings,
+                Ignored,
+            };
+
+            enum class Field
+            {
+                None,
+                Data,
+                ContinuationToken,
+                RequiredPackageMatchFields,
+                UnsupportedPackageMatchFields,
+                PackageIdentifier,
+                PackageName,
+                Publisher,
+                Versions,
+                PackageVersion,
+                Channel,
+                PackageFamilyNames,
+                ProductCodes,
+                UpgradeCodes,
+                AppsAndFeaturesEntryVersions,
+            };
+
+            struct PackageFields
+            {
+                std::optional<std::string> PackageIdentifier;
+                std::optional<std::string> PackageName;
+                std::optional<std::string> Publisher;
+                std::vector<IRestClient::VersionInfo> Versions;
+            };
+
+            // Handles a value that is not an object or array; string values are given, other types are ignored.
+            bool Value(string_t* value)
+            {
+                if (m_scopes.empty())
+                {
+                    AICLI_LOG(Repo, Error, << "Search response is not an object.");
+                    return false;
                 }
 
-                std::optional<std::reference_wrapper<const web::json::array>> versionValue = JSON::GetRawJsonArrayFromJsonNode(manifestItem, JSON::GetUtilityString(Versions));
-                std::vector<IRestClient::VersionInfo> versionList;
+                switch (m_scopes.back())
+                {
+                case Scope::Data:
+                    AICLI_LOG(Repo, Error, << "Missing required package fields in manifest search results.");
+                    return false;
+                case Scope::Versions:
+                    AICLI_LOG(Repo, Error, << "Received incomplete package version");
+                    return false;
+                case Scope::Strings:
+                    if (value)
+                    {
+                        m_strings->emplace_back(std::move(*value));
+                    }
+                    return true;
+                default:
+                    break;
+                }
 
-                if (versionValue)
+                if (value)
                 {
-                    for (auto& versionItem : versionValue.value().get())
+                    switch (m_field)
                     {
-                        auto versionInfo = DeserializeVersionInfo(versionItem);
-                        if (!versionInfo.has_value())
-                        {
-                            AICLI_LOG(Repo, Error, << "Received incomplete package version in package: " << packageId.value());
-                            return {};
-                        }
-
-                        versionList.emplace_back(std::move(*versionInfo));
+                    case Field::ContinuationToken: m_response.ContinuationToken = std::move(*value); break;
+                    case Field::PackageIdentifier: m_package.PackageIdentifier = std::move(*value); break;
+                    case Field::PackageName: m_package.PackageName = std::move(*value); break;
+                    case Field::Publisher: m_package.Publisher = std::move(*value); break;
+                    case Field::PackageVersion: m_version.PackageVersion = std::move(*value); break;
+                    case Field::Channel: m_version.Channel = std::move(*value); break;
+                    default: break;
                     }
                 }
 
-                if (versionList.size() == 0)
+                m_field = Field::None;
+                return true;
+            }
+
+            bool AddVersion()
+            {
+                auto versionInfo = m_deserializeVersionInfo(std::move(m_version));
+                if (!versionInfo.has_value())
                 {
-                    AICLI_LOG(Repo, Error, << "Received no versions in package: " << packageId.value());
-                    return {};
+                    AICLI_LOG(Repo, Error, << "Received incomplete package version in package: " << m_package.PackageIdentifier.value_or(""));
+                    return false;
+                }
+
+                m_package.Versions.emplace_back(std::move(versionInfo).value());
+                return true;
+            }
+
+            bool AddPackage()
+            {
+                if (!JSON::IsValidNonEmptyStringValue(m_package.PackageIdentifier) || !JSON::IsValidNonEmptyStringValue(m_package.PackageName) || !JSON::IsValidNonEmptyStringValue(m_package.Publisher))
+                {
+                    AICLI_LOG(Repo, Error, << "Missing required package fields in manifest search results.");
+                    return false;
+                }
+
+                if (m_package.Versions.empty())
+                {
+                    AICLI_LOG(Repo, Error, << "Received no versions in package: " << m_package.PackageIdentifier.value());
+                    return false;
                 }
 
                 IRestClient::PackageInfo packageInfo{
-                        std::move(packageId.value()), std::move(packageName.value()), std::move(publisher.value()) };
-                IRestClient::Package package{ std::move(packageInfo), std::move(versionList) };
-                result.Matches.emplace_back(std::move(package));
+                        std::move(m_package.PackageIdentifier).value(), std::move(m_package.PackageName).value(), std::move(m_package.Publisher).value() };
+                m_response.Result.Matches.emplace_back(IRestClient::Package{ std::move(packageInfo), std::move(m_package.Versions) });
+                return true;
+            }
+
+            SearchResponse& m_response;
+            VersionInfoDeserializer m_deserializeVersionInfo;
+            std::vector<Scope> m_scopes;
+            Field m_field = Field::None;
+            PackageFields m_package;
+            SearchResponseVersionFields m_version;
+            std::vector<std::string>* m_strings = nullptr;
+        };
+
+        // Reads the top level continuation token, stopping the parse once it has been read.
+        struct ContinuationTokenHandler : public Sax
+        {
+            bool null() override { return Value(nullptr); }
+            bool boolean(bool) override { return Value(nullptr); }
+            bool number_integer(number_integer_t) override { return Value(nullptr); }
+            bool number_unsigned(number_unsigned_t) override { return Value(nullptr); }
+            bool number_float(number_float_t, const string_t&) override { return Value(nullptr); }
+            bool string(string_t& value) override { return Value(&value); }
+            bool binary(binary_t&) override { return Value(nullptr); }
+
+            bool start_object(std::size_t) override { return StartContainer(); }
+            bool end_object() override { --m_depth; return true; }
+            bool start_array(std::size_t) override { return StartContainer(); }
+            bool end_array() override { --m_depth; return true; }
+
+            bool key(string_t& name) override
+            {
+                m_isContinuationToken = m_depth == 1 && name == ContinuationToken;
+                return true;
+            }
+
+            bool parse_error(std::size_t, const std::string&, const nlohmann::json::exception&) override
+            {
+                // The full parse of the body reports the error.
+                return false;
+            }
+
+            std::string Token;
+
+        private:
+            bool StartContainer()
+            {
+                ++m_depth;
+                m_isContinuationToken = false;
+                return true;
             }
 
-            return result;
+            bool Value(string_t* value)
+            {
+                if (m_isContinuationToken && value)
+                {
+                    Token = std::move(*value);
+                    return false;
+                }
+
+                m_isContinuationToken = false;
+                return true;
+            }
+
+            size_t m_depth = 0;
+            bool m_isContinuationToken = false;
+        };
+    }
+
+    SearchResponse SearchResponseDeserializer::Deserialize(std::string_view searchResponseBody) const
+    {
+        SearchResponse result;
+        SearchResponseHandler handler{ result, [this](SearchResponseVersionFields&& versionFields) { return DeserializeVersionInfo(std::move(versionFields)); } };
+
+        bool parsed = false;
+        try
+        {
+            parsed = nlohmann::json::sax_parse(searchResponseBody, &handler);
         }
         catch (const std::exception& e)
         {
             AICLI_LOG(Repo, Error, << "Error encountered while deserializing search result. Reason: " << e.what());
         }
-        catch (...)
+
+        THROW_HR_IF(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA, !parsed);
+
+        if (result.Result.Matches.empty())
         {
-            AICLI_LOG(Repo, Error, << "Error encountered while deserializing search result...");
+            AICLI_LOG(Repo, Verbose, << "No search results returned.");
         }
 
-        return {};
+        return result;
+    }
+
+    std::string SearchResponseDeserializer::DeserializeContinuationToken(std::string_view searchResponseBody)
+    {
+        ContinuationTokenHandler handler;
+        nlohmann::json::sax_parse(searchResponseBody, &handler);
+        return std::move(handler.Token);
     }
 
-    std::optional<IRestClient::VersionInfo> SearchResponseDeserializer::DeserializeVersionInfo(const web::json::value& versionInfoJsonObject) const
+    std::optional<IRestClient::VersionInfo> SearchResponseDeserializer::DeserializeVersionInfo(SearchResponseVersionFields&& versionFields) const
     {
-        std::optional<std::string> version = JSON::GetRawStringValueFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(PackageVersion));
-        if (!JSON::IsValidNonEmptyStringValue(version))
+        if (!JSON::IsValidNonEmptyStringValue(versionFields.PackageVersion))
         {
             AICLI_LOG(Repo, Error, << "Received incomplete package version");
             return {};
         }
 
-        std::string channel = JSON::GetRawStringValueFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(Channel)).value_or("");
-        std::vector<std::string> packageFamilyNames = AppInstaller::Rest::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(PackageFamilyNames)));
-        std::vector<std::string> productCodes = AppInstaller::Rest::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(ProductCodes)));
+        std::string channel = std::move(versionFields.Channel).value_or("");
+        std::vector<std::string> packageFamilyNames = AppInstaller::Rest::GetUniqueItems(versionFields.PackageFamilyNames);
+        std::vector<std::string> productCodes = AppInstaller::Rest::GetUniqueItems(versionFields.ProductCodes);
 
         return IRestClient::VersionInfo{
-            AppInstaller::Utility::VersionAndChannel{std::move(version.value()), std::move(channel)},
+            AppInstaller::Utility::VersionAndChannel{std::move(versionFields.PackageVersion).value(), std::move(channel)},
             {},
             std::move(packageFamilyNames),
             std::move(productCodes) };
@@ -11,6 +11,8 @@
 #include "Rest/Schema/CommonRestConstants.h"
 #include "Rest/Schema/SearchResponseParser.h"
 #include "Rest/Schema/SearchRequestComposer.h"
+#include <deque>
+#include <future>
 
 using namespace std::string_view_literals;
 
@@ -22,6 +24,9 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
         constexpr std::string_view VersionQueryParam = "Version"sv;
         constexpr std::string_view ChannelQueryParam = "Channel"sv;
 
+        // The maximum number of search pages that can be waiting to be parsed while the next page is requested.
+        constexpr size_t MaxPendingSearchPages = 4;
+
         utility::string_t GetSearchEndpoint(const std::string& restApiUri)
         {
             return AppInstaller::Rest::AppendPathToUri(AppInstaller::JSON::GetUtilityString(restApiUri), AppInstaller::JSON::GetUtilityString(ManifestSearchPostEndpoint));
@@ -39,18 +44,6 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
             return AppInstaller::Rest::AppendQueryParamsToUri(getManifestWithPackageIdPath, queryParameters);
         }
 
-        std::optional<utility::string_t> GetContinuationToken(const web::json::value& jsonObject)
-        {
-            std::optional<std::string> continuationToken = AppInstaller::JSON::GetRawStringValueFromJsonNode(jsonObject, AppInstaller::JSON::GetUtilityString(ContinuationToken));
-
-            if (continuationToken)
-            {
-                return utility::conversions::to_string_t(continuationToken.value());
-            }
-
-            return {};
-        }
-
         AppInstaller::Http::HttpClientHelper::HttpResponseHandlerResult CustomRestCallResponseHandler(const web::http::http_response& response)
         {
             AppInstaller::Http::HttpClientHelper::HttpResponseHandlerResult result;
@@ -104,39 +97,91 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
     IRestClient::SearchResult Interface::SearchInternal(const SearchRequest& request) const
     {
         SearchResult results;
-        utility::string_t continuationToken;
+        std::string continuationToken;
         Http::HttpClientHelper::HttpRequestHeaders searchHeaders = m_requiredRestApiHeaders;
+        web::json::value searchBody = GetValidatedSearchBody(request);
+        SearchResponseParser searchResponseParser{ GetVersion() };
+
+        auto addPageResults = [&](SearchResult currentResult)
+        {
+            size_t insertElements = !request.MaximumResults ? currentResult.Matches.size() :
+                std::min(currentResult.Matches.size(), request.MaximumResults - results.Matches.size());
+
+            if (insertElements < currentResult.Matches.size())
+            {
+                results.Truncated = true;
+            }
+
+            std::move(currentResult.Matches.begin(), std::next(currentResult.Matches.begin(), insertElements), std::inserter(results.Matches, results.Matches.end()));
+        };
+
+        // Without a result limit, the results of a page are not needed to decide whether to request the next one.
+        // In that case pages are parsed in the background while the next page is requested, in order and with a cap on how many can be pending.
+        bool pipelinePages = !request.MaximumResults;
+        std::deque<std::future<SearchResult>> pendingPages;
+
+        auto addOldestPendingPage = [&]()
+        {
+            std::future<SearchResult> page = std::move(pendingPages.front());
+            pendingPages.pop_front();
+            addPageResults(page.get());
+        };
+
         do
         {
             if (!continuationToken.empty())
             {
                 AICLI_LOG(Repo, Verbose, << "Received continuation token. Retrieving more results.");
-                searchHeaders.insert_or_assign(AppInstaller::JSON::GetUtilityString(ContinuationToken), continuationToken);
+                searchHeaders.insert_or_assign(AppInstaller::JSON::GetUtilityString(ContinuationToken), AppInstaller::JSON::GetUtilityString(continuationToken));
             }
 
-            std::optional<web::json::value> jsonObject = m_httpClientHelper.HandlePost(m_searchEndpoint, GetValidatedSearchBody(request), searchHeaders, GetAuthHeaders(), CustomRestCallResponseHandler);
+            std::optional<std::string> responseBody = m_responseCache.HandlePostForBody(m_httpClientHelper, m_searchEndpoint, searchBody, searchHeaders, GetAuthHeaders(), CustomRestCallResponseHandler);
 
-            utility::string_t ct;
-            if (jsonObject)
+            std::string ct;
+            if (responseBody)
             {
-                SearchResult currentResult = GetSearchResult(jsonObject.value());
-
-                size_t insertElements = !request.MaximumResults ? currentResult.Matches.size() :
-                    std::min(currentResult.Matches.size(), request.MaximumResults - results.Matches.size());
-
-                if (insertElements < currentResult.Matches.size())
+                if (pipelinePages)
                 {
-                    results.Truncated = true;
+                    // The next page is requested before this one is parsed, so only its continuation token is read here.
+                    ct = SearchResponseParser::GetContinuationToken(responseBody.value());
                 }
 
-                std::move(currentResult.Matches.begin(), std::next(currentResult.Matches.begin(), insertElements), std::inserter(results.Matches, results.Matches.end()));
-                ct = GetContinuationToken(jsonObject.value()).value_or(L"");
+                if (pipelinePages && !ct.empty())
+                {
+                    if (pendingPages.size() >= MaxPendingSearchPages)
+                    {
+                        addOldestPendingPage();
+                    }
+
+                    ThreadLocalStorage::ThreadGlobals* threadGlobals = ThreadLocalStorage::ThreadGlobals::GetForCurrentThread();
+                    pendingPages.emplace_back(std::async(std::launch::async, [this, threadGlobals, &searchResponseParser, page = std::move(responseBody).value()]()
+                        {
+                            auto threadGlobalsCleanup = threadGlobals ? threadGlobals->SetForCurrentThread() : nullptr;
+                            return GetSearchResult(searchResponseParser.Deserialize(page));
+                        }));
+                }
+                else
+                {
+                    while (!pendingPages.empty())
+                    {
+                        addOldestPendingPage();
+                    }
+
+                    SearchResponse searchResponse = searchResponseParser.Deserialize(responseBody.value());
+                    ct = std::move(searchResponse.ContinuationToken);
+                    addPageResults(GetSearchResult(std::move(searchResponse)));
+                }
             }
 
             continuationToken = ct;
 
         } while (!continuationToken.empty() && (!request.MaximumResults || results.Matches.size() < request.MaximumResults));
 
+        while (!pendingPages.empty())
+        {
+            addOldestPendingPage();
+        }
+
         if (!continuationToken.empty())
         {
             results.Truncated = true;
@@ -163,16 +208,17 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
             queryParams.emplace(ChannelQueryParam, channel);
         }
 
-        std::vector<Manifest::Manifest> manifests = GetManifests(packageId, queryParams);
+        // Only the requested version is parsed and validated; the rest of the response is skipped.
+        std::vector<Manifest::Manifest> manifests = GetManifestsInternal(packageId, queryParams, version, channel);
 
         if (!manifests.empty())
         {
-            for (Manifest::Manifest manifest : manifests)
+            for (Manifest::Manifest& manifest : manifests)
             {
                 if (Utility::CaseInsensitiveEquals(manifest.Version, version) &&
                     Utility::CaseInsensitiveEquals(manifest.Channel, channel))
                 {
-                    return manifest;
+                    return std::move(manifest);
                 }
             }
         }
@@ -235,13 +281,18 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
     }
 
     std::vector<Manifest::Manifest> Interface::GetManifests(const std::string& packageId, const std::map<std::string_view, std::string>& params) const
+    {
+        return GetManifestsInternal(packageId, params, {}, {});
+    }
+
+    std::vector<Manifest::Manifest> Interface::GetManifestsInternal(const std::string& packageId, const std::map<std::string_view, std::string>& params, std::string_view version, std::string_view channel) const
     {
         auto validatedParams = GetValidatedQueryParams(params);
 
         std::vector<Manifest::Manifest> results;
         utility::string_t continuationToken;
         Http::HttpClientHelper::HttpRequestHeaders searchHeaders = m_requiredRestApiHeaders;
-        std::optional<web::json::value> jsonObject = m_httpClientHelper.HandleGet(GetManifestByVersionEndpoint(m_restApiUri, packageId, validatedParams), searchHeaders, GetAuthHeaders(), CustomRestCallResponseHandler);
+        std::optional<web::json::value> jsonObject = m_responseCache.HandleGet(m_httpClientHelper, GetManifestByVersionEndpoint(m_restApiUri, packageId, validatedParams), searchHeaders, GetAuthHeaders(), CustomRestCallResponseHandler);
 
         if (!jsonObject)
         {
@@ -250,7 +301,7 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
         }
 
         // Parse json and return Manifests
-        std::vector<Manifest::Manifest> manifests = GetParsedManifests(jsonObject.value());
+        std::vector<Manifest::Manifest> manifests = GetParsedManifests(jsonObject.value(), version, channel);
 
         // Manifest validation
         for (auto& manifestItem : manifests)
@@ -270,7 +321,7 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
 
             THROW_HR_IF(APPINSTALLER_CLI_ERROR_RESTSOURCE_INVALID_DATA, errors > 0);
 
-            results.emplace_back(manifestItem);
+            results.emplace_back(std::move(manifestItem));
         }
 
         return results;
@@ -287,16 +338,21 @@ namespace AppInstaller::Repository::Rest::Schema::V1_0
         return searchRequestComposer.Serialize(searchRequest);
     }
 
-    IRestClient::SearchResult Interface::GetSearchResult(const web::json::value& searchResponseObject) const
+    IRestClient::SearchResult Interface::GetSearchResult(SearchResponse&& searchResponse) const
     {
-        SearchResponseParser searchResponseParser{ GetVersion() };
-        return searchResponseParser.Deserialize(searchResponseObject);
+        return std::move(searchResponse.Result);
     }
 
-    std::vector<Manifest::Manifest> Interface::GetParsedManifests(const web::json::value& manifestsResponseObject) const
+    std::vector<Manifest::Manifest> Interface::GetParsedManifests(const web::json::value& manifestsResponseObject, std::string_view version, std::string_view channel) const
     {
         JSON::ManifestJSONParser manifestParser{ GetVersion() };
-        return manifestParser.Deserialize(manifestsResponseObject);
+
+        if (version.empty())
+        {
+            return manifestParser.Deserialize(manifestsResponseObject);
+        }
+
+        return manifestParser.Deserialize(manifestsResponseObject, version, channel);
     }
 
     Http::HttpClientHelper::HttpRequestHeaders Interface::GetAuthHeaders() const
@@ -17,8 +17,6 @@ namespace AppInstaller::Repository::Rest::Schema::V1_1
         constexpr std::string_view MarketQueryParam = "Market"sv;
 
         // Response constants
-        constexpr std::string_view UnsupportedPackageMatchFields = "UnsupportedPackageMatchFields"sv;
-        constexpr std::string_view RequiredPackageMatchFields = "RequiredPackageMatchFields"sv;
         constexpr std::string_view UnsupportedQueryParameters = "UnsupportedQueryParameters"sv;
         constexpr std::string_view RequiredQueryParameters = "RequiredQueryParameters"sv;
     }
@@ -129,28 +127,21 @@ namespace AppInstaller::Repository::Rest::Schema::V1_1
         return V1_0::Interface::GetValidatedSearchBody(resultSearchRequest);
     }
 
-    IRestClient::SearchResult Interface::GetSearchResult(const web::json::value& searchResponseObject) const
+    IRestClient::SearchResult Interface::GetSearchResult(SearchResponse&& searchResponse) const
     {
-        IRestClient::SearchResult result = V1_0::Interface::GetSearchResult(searchResponseObject);
-
-        if (result.Matches.size() == 0)
+        if (searchResponse.Result.Matches.size() == 0 &&
+            (searchResponse.RequiredPackageMatchFields.size() != 0 || searchResponse.UnsupportedPackageMatchFields.size() != 0))
         {
-            auto requiredPackageMatchFields = JSON::GetRawStringArrayFromJsonNode(searchResponseObject, JSON::GetUtilityString(RequiredPackageMatchFields));
-            auto unsupportedPackageMatchFields = JSON::GetRawStringArrayFromJsonNode(searchResponseObject, JSON::GetUtilityString(UnsupportedPackageMatchFields));
-
-            if (requiredPackageMatchFields.size() != 0 || unsupportedPackageMatchFields.size() != 0)
-            {
-                AICLI_LOG(Repo, Error, << "Search request is not supported by the rest source");
-                throw UnsupportedRequestException(std::move(unsupportedPackageMatchFields), std::move(requiredPackageMatchFields), {}, {});
-            }
+            AICLI_LOG(Repo, Error, << "Search request is not supported by the rest source");
+            throw UnsupportedRequestException(std::move(searchResponse.UnsupportedPackageMatchFields), std::move(searchResponse.RequiredPackageMatchFields), {}, {});
         }
 
-        return result;
+        return V1_0::Interface::GetSearchResult(std::move(searchResponse));
     }
 
-    std::vector<Manifest::Manifest> Interface::GetParsedManifests(const web::json::value& manifestsResponseObject) const
+    std::vector<Manifest::Manifest> Interface::GetParsedManifests(const web::json::value& manifestsResponseObject, std::string_view version, std::string_view channel) const
     {
-        auto result = V1_0::Interface::GetParsedManifests(manifestsResponseObject);
+        auto result = V1_0::Interface::GetParsedManifests(manifestsResponseObject, version, channel);
 
         if (result.size() == 0)
         {
@@ -1,7 +1,6 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 #pragma once
-#include <cpprest/json.h>
 #include "Rest/Schema/1_0/Json/SearchResponseDeserializer.h"
 
 namespace AppInstaller::Repository::Rest::Schema::V1_4::Json
@@ -10,6 +9,6 @@ namespace AppInstaller::Repository::Rest::Schema::V1_4::Json
     struct SearchResponseDeserializer : public V1_0::Json::SearchResponseDeserializer
     {
     protected:
-        std::optional<IRestClient::VersionInfo> DeserializeVersionInfo(const web::json::value& versionInfoJsonObject) const;
+        std::optional<IRestClient::VersionInfo> DeserializeVersionInfo(V1_0::Json::SearchResponseVersionFields&& versionFields) const override;
     };
 }
@@ -2,25 +2,20 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "SearchResponseDeserializer.h"
-#include <winget/JsonUtil.h>
 #include <winget/Rest.h>
 
 namespace AppInstaller::Repository::Rest::Schema::V1_4::Json
 {
-    namespace
+    std::optional<IRestClient::VersionInfo> SearchResponseDeserializer::DeserializeVersionInfo(V1_0::Json::SearchResponseVersionFields&& versionFields) const
     {
-        // Search response constants
-        constexpr std::string_view UpgradeCodes = "UpgradeCodes"sv;
-        constexpr std::string_view AppsAndFeaturesEntryVersions = "AppsAndFeaturesEntryVersions"sv;
-    }
+        std::vector<std::string> upgradeCodes = std::move(versionFields.UpgradeCodes);
+        std::vector<std::string> appsAndFeaturesEntryVersions = std::move(versionFields.AppsAndFeaturesEntryVersions);
 
-    std::optional<IRestClient::VersionInfo> SearchResponseDeserializer::DeserializeVersionInfo(const web::json::value& versionInfoJsonObject) const
-    {
-        auto result = V1_0::Json::SearchResponseDeserializer::DeserializeVersionInfo(versionInfoJsonObject);
+        auto result = V1_0::Json::SearchResponseDeserializer::DeserializeVersionInfo(std::move(versionFields));
         if (result.has_value())
         {
-            result->UpgradeCodes = AppInstaller::Rest::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(UpgradeCodes)));
-            auto arpVersions = AppInstaller::Rest::GetUniqueItems(JSON::GetRawStringArrayFromJsonNode(versionInfoJsonObject, JSON::GetUtilityString(AppsAndFeaturesEntryVersions)));
+            result->UpgradeCodes = AppInstaller::Rest::GetUniqueItems(upgradeCodes);
+            auto arpVersions = AppInstaller::Rest::GetUniqueItems(appsAndFeaturesEntryVersions);
             for (auto const& version : arpVersions)
             {
                 result->ArpVersions.emplace_back(Utility::Version{ version });
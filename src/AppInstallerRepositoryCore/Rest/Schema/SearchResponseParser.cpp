@@ -42,8 +42,13 @@ namespace AppInstaller::Repository::Rest::Schema
         }
     }
 
-    IRestClient::SearchResult SearchResponseParser::Deserialize(const web::json::value& searchResultJsonObject) const
+    SearchResponse SearchResponseParser::Deserialize(std::string_view searchResponseBody) const
     {
-        return m_pImpl->m_deserializer->Deserialize(searchResultJsonObject);
+        return m_pImpl->m_deserializer->Deserialize(searchResponseBody);
+    }
+
+    std::string SearchResponseParser::GetContinuationToken(std::string_view searchResponseBody)
+    {
+        return Rest::Schema::V1_0::Json::SearchResponseDeserializer::DeserializeContinuationToken(searchResponseBody);
     }
 }
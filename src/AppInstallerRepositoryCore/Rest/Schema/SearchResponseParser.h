@@ -6,11 +6,27 @@
 #include "Rest/Schema/IRestClient.h"
 
 #include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace AppInstaller::Repository::Rest::Schema
 {
+    // A page of search results, along with the response fields that describe it.
+    struct SearchResponse
+    {
+        IRestClient::SearchResult Result;
+
+        // Empty on the last page.
+        std::string ContinuationToken;
+
+        // Set by sources that do not support the request.
+        std::vector<std::string> RequiredPackageMatchFields;
+        std::vector<std::string> UnsupportedPackageMatchFields;
+    };
+
     // Exposes functions for parsing JSON REST responses to IRestClient SearchResult.
+    // The UTF-8 response body is parsed directly into the results, without first building a JSON value for it.
     struct SearchResponseParser
     {
         SearchResponseParser(const Utility::Version& schemaVersion);
@@ -23,8 +39,11 @@ namespace AppInstaller::Repository::Rest::Schema
 
         ~SearchResponseParser();
 
-        // Gets the search result for response object
-        IRestClient::SearchResult Deserialize(const web::json::value& searchResultJsonObject) const;
+        // Gets the search response from the UTF-8 response body.
+        SearchResponse Deserialize(std::string_view searchResponseBody) const;
+
+        // Gets only the continuation token from the UTF-8 response body; empty if there is none.
+        static std::string GetContinuationToken(std::string_view searchResponseBody);
 
     private:
         struct impl;
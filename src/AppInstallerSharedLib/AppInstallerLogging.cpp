@@ -216,6 +216,105 @@ namespace AppInstaller::Logging
     {
         return out << std::hex << std::setw(8) << std::setfill('0');
     }
+
+    namespace details
+    {
+        // Appends to a string that keeps its capacity from one message to the next.
+        struct LogMessageBuffer : public std::streambuf
+        {
+            LogMessageBuffer() : Stream(this)
+            {
+                DefaultFlags = Stream.flags();
+                DefaultPrecision = Stream.precision();
+            }
+
+            // Prepares for a new message, undoing any formatting changes left by the previous one.
+            void Reset()
+            {
+                Message.clear();
+                Stream.clear();
+                Stream.flags(DefaultFlags);
+                Stream.precision(DefaultPrecision);
+                Stream.width(0);
+                Stream.fill(' ');
+            }
+
+            std::string Message;
+            std::ostream Stream;
+            bool InUse = false;
+
+        protected:
+            int_type overflow(int_type ch) override
+            {
+                if (!traits_type::eq_int_type(ch, traits_type::eof()))
+                {
+                    Message.push_back(traits_type::to_char_type(ch));
+                }
+
+                return traits_type::not_eof(ch);
+            }
+
+            std::streamsize xsputn(const char* s, std::streamsize count) override
+            {
+                Message.append(s, static_cast<size_t>(count));
+                return count;
+            }
+
+        private:
+            std::ios_base::fmtflags DefaultFlags;
+            std::streamsize DefaultPrecision;
+        };
+    }
+
+    namespace
+    {
+        // Do not keep the memory from an unusually large message.
+        constexpr size_t s_MaximumRetainedLogMessageCapacity = 64 * 1024;
+
+        details::LogMessageBuffer& GetThreadLogMessageBuffer()
+        {
+            thread_local details::LogMessageBuffer t_buffer;
+            return t_buffer;
+        }
+    }
+
+    LoggingStream::LoggingStream()
+    {
+        details::LogMessageBuffer& threadBuffer = GetThreadLogMessageBuffer();
+
+        // A value being logged may itself log while being formatted; that message gets its own buffer.
+        if (threadBuffer.InUse)
+        {
+            m_ownedBuffer = std::make_unique<details::LogMessageBuffer>();
+            m_buffer = m_ownedBuffer.get();
+        }
+        else
+        {
+            m_buffer = &threadBuffer;
+            m_buffer->InUse = true;
+            m_buffer->Reset();
+        }
+
+        m_out = &m_buffer->Stream;
+    }
+
+    LoggingStream::~LoggingStream()
+    {
+        if (!m_ownedBuffer)
+        {
+            if (m_buffer->Message.capacity() > s_MaximumRetainedLogMessageCapacity)
+            {
+                m_buffer->Message = std::string{};
+            }
+
+            m_buffer->InUse = false;
+        }
+    }
+
+    std::string_view LoggingStream::view() const
+    {
+        return m_buffer->Message;
+    }
 }
 
 namespace std
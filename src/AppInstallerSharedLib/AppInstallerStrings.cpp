@@ -158,11 +158,111 @@ namespace AppInstaller::Utility
             result.emplace_back(trim ? Utility::Trim(input.substr(startIndex)) : input.substr(startIndex));
             return result;
         }
+
+        // The ASCII helpers below work on a word of bytes at a time rather than using a particular instruction set.
+        constexpr uint64_t s_WordHighBits = 0x8080808080808080ull;
+        constexpr uint64_t s_WordLowBits = 0x0101010101010101ull;
+
+        uint64_t LoadWord(const char* data)
+        {
+            uint64_t result;
+            memcpy(&result, data, sizeof(result));
+            return result;
+        }
+
+        // Lowers any upper case ASCII letters in the word, leaving all other bytes unchanged.
+        uint64_t ToLowerASCIIWord(uint64_t word)
+        {
+            // With the high bits cleared, the additions cannot carry between bytes.
+            // The high bit of each byte is then set if the byte is at least 'A', and if it is above 'Z', respectively.
+            uint64_t sevenBits = word & ~s_WordHighBits;
+            uint64_t atLeastA = sevenBits + (0x80 - 'A') * s_WordLowBits;
+            uint64_t aboveZ = sevenBits + (0x80 - 'Z' - 1) * s_WordLowBits;
+            uint64_t isUpper = atLeastA & ~aboveZ & ~word & s_WordHighBits;
+
+            // Move the high bit down to the case bit (0x20)
+            return word | (isUpper >> 2);
+        }
+
+        char ToLowerASCII(char c)
+        {
+            return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+        }
+
+        bool IsASCII(std::string_view input)
+        {
+            uint64_t combined = 0;
+            size_t i = 0;
+
+            for (; i + sizeof(uint64_t) <= input.length(); i += sizeof(uint64_t))
+            {
+                combined |= LoadWord(input.data() + i);
+            }
+
+            for (; i < input.length(); ++i)
+            {
+                combined |= static_cast<uint8_t>(input[i]);
+            }
+
+            return (combined & s_WordHighBits) == 0;
+        }
+
+        // Equivalent to comparing the strings after std::tolower in the "C" locale; only ASCII letters are affected.
+        bool ASCIICaseInsensitiveEquals(std::string_view a, std::string_view b)
+        {
+            if (a.length() != b.length())
+            {
+                return false;
+            }
+
+            size_t i = 0;
+
+            for (; i + sizeof(uint64_t) <= a.length(); i += sizeof(uint64_t))
+            {
+                if (ToLowerASCIIWord(LoadWord(a.data() + i)) != ToLowerASCIIWord(LoadWord(b.data() + i)))
+                {
+                    return false;
+                }
+            }
+
+            for (; i < a.length(); ++i)
+            {
+                if (ToLowerASCII(a[i]) != ToLowerASCII(b[i]))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        void ToLowerASCIIInPlace(std::string& value)
+        {
+            size_t i = 0;
+
+            for (; i + sizeof(uint64_t) <= value.length(); i += sizeof(uint64_t))
+            {
+                uint64_t word = ToLowerASCIIWord(LoadWord(&value[i]));
+                memcpy(&value[i], &word, sizeof(word));
+            }
+
+            for (; i < value.length(); ++i)
+            {
+                value[i] = ToLowerASCII(value[i]);
+            }
+        }
+
+        // The ICU case folding result has any trailing null characters removed.
+        std::string_view RemoveTrailingNulls(std::string_view value)
+        {
+            size_t end = value.find_last_not_of('\0');
+            return value.substr(0, end == std::string_view::npos ? 0 : end + 1);
+        }
     }
 
     bool CaseInsensitiveEquals(std::string_view a, std::string_view b)
     {
-        return ToLower(a) == ToLower(b);
+        return ASCIICaseInsensitiveEquals(a, b);
     }
 
     bool CaseInsensitiveEquals(std::wstring_view a, std::wstring_view b)
@@ -172,8 +272,7 @@ namespace AppInstaller::Utility
 
     bool CaseInsensitiveContains(const std::vector<std::string_view>& a, std::string_view b)
     {
-        auto B = ToLower(b);
-        return std::any_of(a.begin(), a.end(), [&](const std::string_view& s) { return ToLower(s) == B; });
+        return std::any_of(a.begin(), a.end(), [&](const std::string_view& s) { return ASCIICaseInsensitiveEquals(s, b); });
     }
 
     bool StartsWith(std::wstring_view a, std::wstring_view b)
@@ -196,7 +295,7 @@ namespace AppInstaller::Utility
         auto it = std::search(
             a.begin(), a.end(),
             b.begin(), b.end(),
-            [](char ch1, char ch2) { return std::tolower(ch1) == std::tolower(ch2); }
+            [](char ch1, char ch2) { return ToLowerASCII(ch1) == ToLowerASCII(ch2); }
         );
         return (it != a.end());
     }
@@ -212,6 +311,12 @@ namespace AppInstaller::Utility
 
     bool ICUCaseInsensitiveEquals(std::string_view a, std::string_view b)
     {
+        // Case folding only changes ASCII letters in ASCII strings, so there is no need for ICU
+        if (IsASCII(a) && IsASCII(b))
+        {
+            return ASCIICaseInsensitiveEquals(RemoveTrailingNulls(a), RemoveTrailingNulls(b));
+        }
+
         return FoldCase(a) == FoldCase(b);
     }
 
@@ -423,7 +528,31 @@ namespace AppInstaller::Utility
             return {};
         }
 
-        return ConvertToUTF8(Normalize(ConvertToUTF16(input), form));
+        // ASCII is unchanged by every normalization form.
+        if (IsASCII(input))
+        {
+            return std::string{ input };
+        }
+
+        // Invalid sequences are replaced during conversion, so only valid input can be returned as is.
+        int inputLength = wil::safe_cast<int>(input.length());
+        int utf16CharCount = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, input.data(), inputLength, nullptr, 0);
+        if (utf16CharCount == 0)
+        {
+            return ConvertToUTF8(Normalize(ConvertToUTF16(input), form));
+        }
+
+        std::wstring utf16(utf16CharCount, L'\0');
+        int utf16CharsWritten = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, input.data(), inputLength, &utf16[0], utf16CharCount);
+        FAIL_FAST_HR_IF(E_UNEXPECTED, utf16CharCount != utf16CharsWritten);
+
+        // Most text is already normalized; keep the original rather than normalizing and converting back.
+        if (IsNormalizedString(form, utf16.data(), utf16CharCount))
+        {
+            return std::string{ input };
+        }
+
+        return ConvertToUTF8(Normalize(utf16, form));
     }
 
     std::wstring Normalize(std::wstring_view input, NORM_FORM form)
@@ -473,8 +602,7 @@ namespace AppInstaller::Utility
     std::string ToLower(std::string_view in)
     {
         std::string result(in);
-        std::transform(result.begin(), result.end(), result.begin(),
-            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        ToLowerASCIIInPlace(result);
         return result;
     }
 
@@ -493,6 +621,14 @@ namespace AppInstaller::Utility
             return {};
         }
 
+        // Case folding only changes ASCII letters in ASCII strings, so there is no need for ICU
+        if (IsASCII(input))
+        {
+            std::string result{ RemoveTrailingNulls(input) };
+            ToLowerASCIIInPlace(result);
+            return result;
+        }
+
         wil::unique_any<UCaseMap*, decltype(ucasemap_close), &ucasemap_close> caseMap;
         UErrorCode errorCode = UErrorCode::U_ZERO_ERROR;
         caseMap.reset(ucasemap_open(nullptr, U_FOLD_CASE_DEFAULT, &errorCode));
@@ -2,9 +2,29 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "Public/winget/Compression.h"
+#include <zlib.h>
 
 namespace AppInstaller::Compression
 {
+    namespace
+    {
+        void ThrowIfZlibFailed(int status)
+        {
+            switch (status)
+            {
+            case Z_OK:
+            case Z_STREAM_END:
+                return;
+            case Z_MEM_ERROR:
+                THROW_HR(E_OUTOFMEMORY);
+            case Z_DATA_ERROR:
+                THROW_HR(HRESULT_FROM_WIN32(ERROR_INVALID_DATA));
+            default:
+                THROW_HR_MSG(E_UNEXPECTED, "zlib error: %d", status);
+            }
+        }
+    }
+
     Compressor::Compressor(DWORD algorithm)
     {
         THROW_IF_WIN32_BOOL_FALSE(CreateCompressor(algorithm, nullptr, &m_compressor));
@@ -56,22 +76,31 @@ namespace AppInstaller::Compression
     std::vector<uint8_t> Decompressor::Decompress(const std::vector<uint8_t>& data)
     {
         std::vector<uint8_t> result;
+        Decompress(std::string_view{ reinterpret_cast<const char*>(data.data()), data.size() }, result);
+        return result;
+    }
 
-        if (!data.empty())
+    void Decompressor::Decompress(std::string_view data, std::vector<uint8_t>& result)
+    {
+        if (data.empty())
         {
-            SIZE_T decompressedBufferSize = 0;
-            THROW_HR_IF(E_UNEXPECTED, ::Decompress(m_decompressor.get(), data.data(), data.size(), nullptr, 0, &decompressedBufferSize));
-            THROW_LAST_ERROR_IF(GetLastError() != ERROR_INSUFFICIENT_BUFFER);
+            result.clear();
+            return;
+        }
 
-            result.resize(decompressedBufferSize);
+        // Try the existing capacity first; the required size is only queried when it is too small.
+        result.resize(result.capacity());
 
-            SIZE_T decompressedDataSize = 0;
-            THROW_IF_WIN32_BOOL_FALSE(::Decompress(m_decompressor.get(), data.data(), data.size(), &result[0], result.size(), &decompressedDataSize));
+        SIZE_T decompressedDataSize = 0;
+        if (!::Decompress(m_decompressor.get(), data.data(), data.size(), result.data(), result.size(), &decompressedDataSize))
+        {
+            THROW_LAST_ERROR_IF(GetLastError() != ERROR_INSUFFICIENT_BUFFER);
 
             result.resize(decompressedDataSize);
+            THROW_IF_WIN32_BOOL_FALSE(::Decompress(m_decompressor.get(), data.data(), data.size(), result.data(), result.size(), &decompressedDataSize));
         }
 
-        return result;
+        result.resize(decompressedDataSize);
     }
 
     void Decompressor::Reset()
@@ -90,4 +119,90 @@ namespace AppInstaller::Compression
         THROW_IF_WIN32_BOOL_FALSE(QueryDecompressorInformation(m_decompressor.get(), information, &result, sizeof(result)));
         return result;
     }
+
+    std::vector<uint8_t> ZlibCompressor::Compress(std::string_view data)
+    {
+        std::vector<uint8_t> result;
+
+        if (!data.empty())
+        {
+            THROW_HR_IF(E_INVALIDARG, data.size() > std::numeric_limits<uLong>::max());
+
+            uLongf compressedDataSize = compressBound(static_cast<uLong>(data.size()));
+            result.resize(compressedDataSize);
+
+            ThrowIfZlibFailed(compress2(result.data(), &compressedDataSize, reinterpret_cast<const Bytef*>(data.data()), static_cast<uLong>(data.size()), Z_BEST_COMPRESSION));
+
+            result.resize(compressedDataSize);
+        }
+
+        return result;
+    }
+
+    ZlibDecompressor::ZlibDecompressor() : m_stream(new z_stream{})
+    {
+        int status = inflateInit(m_stream.get());
+        if (status != Z_OK)
+        {
+            // The stream was not initialized, so it must not be ended.
+            delete m_stream.release();
+            ThrowIfZlibFailed(status);
+        }
+    }
+
+    std::vector<uint8_t> ZlibDecompressor::Decompress(const std::vector<uint8_t>& data)
+    {
+        std::vector<uint8_t> result;
+        Decompress(std::string_view{ reinterpret_cast<const char*>(data.data()), data.size() }, result);
+        return result;
+    }
+
+    void ZlibDecompressor::Decompress(std::string_view data, std::vector<uint8_t>& result)
+    {
+        if (data.empty())
+        {
+            result.clear();
+            return;
+        }
+
+        THROW_HR_IF(E_INVALIDARG, data.size() > std::numeric_limits<uInt>::max());
+        ThrowIfZlibFailed(inflateReset(m_stream.get()));
+
+        m_stream->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+        m_stream->avail_in = static_cast<uInt>(data.size());
+
+        // The decompressed size is not stored, so start from the existing capacity and grow as needed.
+        result.resize(std::max(result.capacity(), data.size() * 4));
+
+        for (;;)
+        {
+            size_t written = static_cast<size_t>(m_stream->total_out);
+            m_stream->next_out = result.data() + written;
+            m_stream->avail_out = static_cast<uInt>(std::min<size_t>(result.size() - written, std::numeric_limits<uInt>::max()));
+
+            int status = inflate(m_stream.get(), Z_NO_FLUSH);
+            if (status == Z_STREAM_END)
+            {
+                break;
+            }
+
+            if (status == Z_BUF_ERROR || (status == Z_OK && m_stream->avail_out == 0))
+            {
+                // No progress is possible without more input, so the data is truncated.
+                THROW_HR_IF(HRESULT_FROM_WIN32(ERROR_INVALID_DATA), m_stream->avail_in == 0 && m_stream->avail_out != 0);
+                result.resize(result.size() * 2);
+                continue;
+            }
+
+            ThrowIfZlibFailed(status);
+        }
+
+        result.resize(static_cast<size_t>(m_stream->total_out));
+    }
+
+    void ZlibDecompressor::StreamDeleter::operator()(z_stream_s* stream) const
+    {
+        inflateEnd(stream);
+        delete stream;
+    }
 }
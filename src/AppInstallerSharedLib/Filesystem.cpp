@@ -825,4 +825,49 @@ namespace AppInstaller::Filesystem
             totalBytesWritten += bytesWritten;
         }
     }
+
+    bool FileIdentity::operator==(const FileIdentity& other) const
+    {
+        return VolumeSerialNumber == other.VolumeSerialNumber &&
+            FileId == other.FileId &&
+            Size == other.Size &&
+            LastWriteTime == other.LastWriteTime &&
+            ChangeTime == other.ChangeTime;
+    }
+
+    FileIdentity GetFileIdentity(HANDLE fileHandle)
+    {
+        FILE_ID_INFO idInfo{};
+        THROW_IF_WIN32_BOOL_FALSE(GetFileInformationByHandleEx(fileHandle, FileIdInfo, &idInfo, sizeof(idInfo)));
+
+        FILE_BASIC_INFO basicInfo{};
+        THROW_IF_WIN32_BOOL_FALSE(GetFileInformationByHandleEx(fileHandle, FileBasicInfo, &basicInfo, sizeof(basicInfo)));
+
+        FILE_STANDARD_INFO standardInfo{};
+        THROW_IF_WIN32_BOOL_FALSE(GetFileInformationByHandleEx(fileHandle, FileStandardInfo, &standardInfo, sizeof(standardInfo)));
+
+        FileIdentity result;
+        result.VolumeSerialNumber = idInfo.VolumeSerialNumber;
+        static_assert(sizeof(result.FileId) == sizeof(idInfo.FileId.Identifier));
+        std::memcpy(result.FileId.data(), idInfo.FileId.Identifier, result.FileId.size());
+        result.Size = static_cast<uint64_t>(standardInfo.EndOfFile.QuadPart);
+        result.LastWriteTime = basicInfo.LastWriteTime.QuadPart;
+        result.ChangeTime = basicInfo.ChangeTime.QuadPart;
+        return result;
+    }
+
+    FileIdentity GetWrittenFileIdentity(HANDLE fileHandle)
+    {
+        FILETIME now{};
+        GetSystemTimeAsFileTime(&now);
+
+        // Zero values are left unchanged; a time set through the handle is not updated again when it is closed.
+        FILE_BASIC_INFO writeTimes{};
+        writeTimes.LastWriteTime.LowPart = now.dwLowDateTime;
+        writeTimes.LastWriteTime.HighPart = static_cast<LONG>(now.dwHighDateTime);
+        writeTimes.ChangeTime = writeTimes.LastWriteTime;
+        THROW_IF_WIN32_BOOL_FALSE(SetFileInformationByHandle(fileHandle, FileBasicInfo, &writeTimes, sizeof(writeTimes)));
+
+        return GetFileIdentity(fileHandle);
+    }
 }
@@ -20,7 +20,7 @@
         { \
             AppInstaller::Logging::LoggingStream _aicli_log_strstr; \
             _aicli_log_strstr _outstream_; \
-            _aicli_log_log.Write(_aicli_log_channel, _aicli_log_level, _aicli_log_strstr.str()); \
+            _aicli_log_log.Write(_aicli_log_channel, _aicli_log_level, _aicli_log_strstr.view()); \
         } \
     } while (0, 0)
 
@@ -37,7 +37,7 @@
         { \
             AppInstaller::Logging::LoggingStream _aicli_log_strstr; \
             _aicli_log_strstr _headerStream_; \
-            _aicli_log_log.Write(_aicli_log_channel, _aicli_log_level, _aicli_log_strstr.str()); \
+            _aicli_log_log.Write(_aicli_log_channel, _aicli_log_level, _aicli_log_strstr.view()); \
             _aicli_log_log.WriteDirect(_aicli_log_channel, _aicli_log_level, _largeString_); \
         } \
     } while (0, 0)
@@ -201,14 +201,31 @@ namespace AppInstaller::Logging
     // Calls the various stream format functions to produce an 8 character hexadecimal output.
     std::ostream& SetHRFormat(std::ostream& out);
 
+    namespace details
+    {
+        // The buffer that a log message is formatted into.
+        struct LogMessageBuffer;
+    }
+
     // This type allows us to override the default behavior of output operators for logging.
+    // The message is formatted into a buffer that is reused by the thread, so that logging does not
+    // construct a stream or allocate once the buffer has grown to fit the messages.
     struct LoggingStream
     {
+        LoggingStream();
+        ~LoggingStream();
+
+        LoggingStream(const LoggingStream&) = delete;
+        LoggingStream& operator=(const LoggingStream&) = delete;
+
+        LoggingStream(LoggingStream&&) = delete;
+        LoggingStream& operator=(LoggingStream&&) = delete;
+
         // Force use of the UTF-8 string from a file path.
         // This should not be necessary when we move to C++20 and convert to using u8string.
         friend AppInstaller::Logging::LoggingStream& operator<<(AppInstaller::Logging::LoggingStream& out, const std::filesystem::path& path)
         {
-            out.m_out << path.u8string();
+            *out.m_out << path.u8string();
             return out;
         }
 
@@ -217,7 +234,7 @@ namespace AppInstaller::Logging
         friend std::enable_if_t<std::is_enum_v<std::decay_t<T>>, AppInstaller::Logging::LoggingStream&>
             operator<<(AppInstaller::Logging::LoggingStream& out, T t)
         {
-            out.m_out << ToIntegral(t);
+            *out.m_out << ToIntegral(t);
             return out;
         }
 
@@ -226,14 +243,19 @@ namespace AppInstaller::Logging
         friend std::enable_if_t<!std::disjunction_v<std::is_same<std::decay_t<T>, std::filesystem::path>, std::is_enum<std::decay_t<T>>>, AppInstaller::Logging::LoggingStream&>
             operator<<(AppInstaller::Logging::LoggingStream& out, T&& t)
         {
-            out.m_out << std::forward<T>(t);
+            *out.m_out << std::forward<T>(t);
             return out;
         }
 
-        std::string str() const { return m_out.str(); }
+        // Gets the formatted message; only valid for the lifetime of this object.
+        std::string_view view() const;
+
+        std::string str() const { return std::string{ view() }; }
 
     private:
-        std::stringstream m_out;
+        details::LogMessageBuffer* m_buffer = nullptr;
+        std::unique_ptr<details::LogMessageBuffer> m_ownedBuffer;
+        std::ostream* m_out = nullptr;
     };
 }
 
@@ -68,10 +68,22 @@ namespace AppInstaller::Utility {
         // Computes the hash from a given file path.
         static HashBuffer ComputeHashFromFile(const std::filesystem::path& path);
 
+        // Computes the hash from a given file path, overlapping reading the file with hashing it.
+        static HashDetails ComputeHashDetailsFromFile(const std::filesystem::path& path);
+
+        // Computes the hashes of the files at the given paths concurrently, using at most maxConcurrency threads (0 for one per processor).
+        // The results are in the same order as the paths. If any file fails, the first failure is thrown once all work has stopped.
+        static std::vector<HashDetails> ComputeHashDetailsFromFiles(const std::vector<std::filesystem::path>& paths, size_t maxConcurrency = 0);
+
         // Computes the hash from an open file HANDLE by reading sequentially from the current position.
         // The caller retains ownership of the handle.
         static HashBuffer ComputeHashFromHandle(HANDLE fileHandle);
 
+        // Computes the hash of the entire contents of a file HANDLE opened with FILE_FLAG_OVERLAPPED.
+        // Multiple large reads are kept in flight so that reading the file overlaps with hashing it.
+        // The caller retains ownership of the handle, and should prevent writes to the file while hashing.
+        static HashDetails ComputeHashDetailsFromOverlappedHandle(HANDLE fileHandle);
+
         static std::string ConvertToString(const HashBuffer& hashBuffer);
 
         static std::wstring ConvertToWideString(const HashBuffer& hashBuffer);
@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 #pragma once
+#include <array>
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -24,6 +26,9 @@ namespace AppInstaller::Utility
     //      else if string parts not equal, return comparison of strings
     //  if each part has been compared, use approximate comparator if applicable
     //
+    //  Versions made up of only a few integer parts, which is by far the most common case, are also kept in a packed form
+    //  that allows them to be compared without walking the parts.
+    //
     //  Note: approximate to another approximate version is invalid.
     //        approximate to Unknown is invalid.
     struct Version
@@ -83,7 +88,7 @@ namespace AppInstaller::Utility
         {
             Part() = default;
             Part(uint64_t integer) : Integer(integer) {}
-            Part(const std::string& part);
+            Part(std::string_view part);
             Part(uint64_t integer, std::string other);
 
             bool operator<(const Part& other) const;
@@ -109,10 +114,13 @@ namespace AppInstaller::Utility
         // Get the base version from approximate version, or return a copy if the version is not approximate.
         Version GetBaseVersion() const;
 
+        // Gets a binary key that orders the same as this version when compared bytewise; for instance by a database.
+        std::vector<uint8_t> GetSortKey() const;
+
     protected:
 
-        bool IsBaseVersionLatest() const;
-        bool IsBaseVersionUnknown() const;
+        bool IsBaseVersionLatest() const { return m_isBaseVersionLatest; }
+        bool IsBaseVersionUnknown() const { return m_isBaseVersionUnknown; }
         // Called by overloaded less than operator implementation when base version already compared and equal, less than determined by approximate comparator.
         bool ApproximateCompareLessThan(const Version& other) const;
 
@@ -123,6 +131,18 @@ namespace AppInstaller::Utility
 
       // Remove trailing empty parts (0 or empty)
         void Trim();
+
+        // Recomputes the state derived from the parts that is used for comparisons.
+        // Must be called whenever m_parts is modified; Trim does so itself.
+        void UpdateComparisonKey();
+
+    private:
+        // The integers of the parts, padded with zeros, when all parts are integers and there are few enough of them.
+        // Comparing these directly is equivalent to comparing the parts, as the padding matches the implied zero parts.
+        std::array<uint64_t, 4> m_packedParts{};
+        bool m_isPacked = true;
+        bool m_isBaseVersionLatest = false;
+        bool m_isBaseVersionUnknown = false;
     };
 
     // Version that does not have leading non-digit characters trimmed
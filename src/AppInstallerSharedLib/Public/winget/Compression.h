@@ -3,11 +3,23 @@
 #pragma once
 #include <wil/resource.h>
 #include <compressapi.h>
+#include <memory>
 #include <vector>
 #include <string_view>
 
+struct z_stream_s;
+
 namespace AppInstaller::Compression
 {
+    // The interface for a decompression backend.
+    struct IDecompressor
+    {
+        virtual ~IDecompressor() = default;
+
+        // Decompresses the given data into the result, reusing its existing capacity.
+        virtual void Decompress(std::string_view data, std::vector<uint8_t>& result) = 0;
+    };
+
     // Contains a compressor from the Windows Compression API.
     struct Compressor
     {
@@ -31,7 +43,7 @@ namespace AppInstaller::Compression
     };
 
     // Contains a decompressor from the Windows Compression API.
-    struct Decompressor
+    struct Decompressor : public IDecompressor
     {
         // Create a decompressor using the given algorithm (see COMPRESS_ALGORITHM_*)
         Decompressor(DWORD algorithm);
@@ -39,6 +51,9 @@ namespace AppInstaller::Compression
         // Decompresses the given data.
         std::vector<uint8_t> Decompress(const std::vector<uint8_t>& data);
 
+        // Decompresses the given data into the result, reusing its existing capacity.
+        void Decompress(std::string_view data, std::vector<uint8_t>& result) override;
+
         // Resets the decompressor.
         void Reset();
 
@@ -51,4 +66,31 @@ namespace AppInstaller::Compression
     private:
         wil::unique_any<DECOMPRESSOR_HANDLE, decltype(CloseDecompressor), CloseDecompressor> m_decompressor;
     };
+
+    // Contains a zlib (RFC 1950) compressor, which does not depend on the Windows Compression API.
+    struct ZlibCompressor
+    {
+        // Compresses the given data.
+        std::vector<uint8_t> Compress(std::string_view data);
+    };
+
+    // Contains a zlib (RFC 1950) decompressor, which does not depend on the Windows Compression API.
+    struct ZlibDecompressor : public IDecompressor
+    {
+        ZlibDecompressor();
+
+        // Decompresses the given data.
+        std::vector<uint8_t> Decompress(const std::vector<uint8_t>& data);
+
+        // Decompresses the given data into the result, reusing its existing capacity.
+        void Decompress(std::string_view data, std::vector<uint8_t>& result) override;
+
+    private:
+        struct StreamDeleter
+        {
+            void operator()(z_stream_s* stream) const;
+        };
+
+        std::unique_ptr<z_stream_s, StreamDeleter> m_stream;
+    };
 }
@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 #pragma once
+#include <array>
 #include <filesystem>
 #include <map>
 #include <optional>
@@ -152,4 +153,26 @@ namespace AppInstaller::Filesystem
 
     // Writes the given string to the file handle, handling partial writes.
     void WriteStringToFile(HANDLE fileHandle, std::string_view content);
+
+    // Identifies a file and the state of its contents.
+    // If the contents are written to, the identity will no longer be equal.
+    struct FileIdentity
+    {
+        uint64_t VolumeSerialNumber = 0;
+        std::array<uint8_t, 16> FileId{};
+        uint64_t Size = 0;
+        int64_t LastWriteTime = 0;
+        int64_t ChangeTime = 0;
+
+        bool operator==(const FileIdentity& other) const;
+        bool operator!=(const FileIdentity& other) const { return !(*this == other); }
+    };
+
+    // Gets the identity of the open file.
+    FileIdentity GetFileIdentity(HANDLE fileHandle);
+
+    // Gets the identity of a file that was written through the handle.
+    // The write times are set explicitly first, so that closing the handle does not change them (and with them the identity).
+    // The handle must have FILE_READ_ATTRIBUTES and FILE_WRITE_ATTRIBUTES access.
+    FileIdentity GetWrittenFileIdentity(HANDLE fileHandle);
 }
@@ -18,6 +18,15 @@ namespace AppInstaller::JsonSchema
     // Returns whether it was successful and fills the results object
     bool Validate(const valijson::Schema& schema, const Json::Value& json, valijson::ValidationResults& results);
 
+    // Validate a document exposed through a valijson adapter with a schema
+    // Returns whether it was successful and fills the results object
+    template <typename Adapter>
+    bool Validate(const valijson::Schema& schema, const Adapter& adapter, valijson::ValidationResults& results)
+    {
+        valijson::Validator schemaValidator;
+        return schemaValidator.validate(schema, adapter, &results);
+    }
+
     // Extracts the error messages from a result into a single non-localized string
     std::string GetErrorStringFromResults(valijson::ValidationResults& results);
 }
\ No newline at end of file
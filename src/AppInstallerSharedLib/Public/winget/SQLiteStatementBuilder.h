@@ -343,6 +343,7 @@ namespace AppInstaller::SQLite::Builder
         StatementBuilder& OrderBy(std::string_view column);
         StatementBuilder& OrderBy(const QualifiedColumn& column);
         StatementBuilder& OrderBy(std::initializer_list<std::string_view> columns);
+        StatementBuilder& OrderBy(std::initializer_list<QualifiedColumn> columns);
 
         // Specify the ordering behavior.
         StatementBuilder& Ascending();
@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace AppInstaller::Timing
+{
+    // The phases of an operation that can be timed.
+    // Phases may nest (a correlation includes the searches it performs), so their totals are not additive.
+    enum class Phase : size_t
+    {
+        SourceOpen,
+        SourceUpdate,
+        Search,
+        Correlation,
+        ManifestFetch,
+        ManifestParse,
+        Download,
+        Hash,
+        Install,
+        // Must be last; the number of phases.
+        Max,
+    };
+
+    // Gets the name of the phase, as used in the summary output.
+    std::string_view ToString(Phase phase);
+
+    // Enables or disables collection for the process; it is disabled by default.
+    // While disabled, a timer costs a single relaxed atomic load.
+    void SetEnabled(bool enabled);
+
+    // Determines whether collection is enabled.
+    bool IsEnabled();
+
+    // Records one occurrence of the phase that took the given duration.
+    // Does nothing if collection is disabled.
+    void Record(Phase phase, std::chrono::steady_clock::duration duration);
+
+    // Times a phase from construction until it is stopped or destroyed.
+    // The timer is thread agnostic; any number of them can be active concurrently.
+    struct ScopedTimer
+    {
+        explicit ScopedTimer(Phase phase);
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        ScopedTimer(ScopedTimer&&) = delete;
+        ScopedTimer& operator=(ScopedTimer&&) = delete;
+
+        ~ScopedTimer();
+
+        // Records the elapsed time now rather than on destruction; later calls do nothing.
+        void Stop();
+
+    private:
+        Phase m_phase;
+        bool m_active = false;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    // The aggregate of the recorded occurrences of a phase.
+    struct PhaseSummary
+    {
+        Timing::Phase Phase = Timing::Phase::Max;
+        uint64_t Count = 0;
+        std::chrono::nanoseconds Total{};
+        std::chrono::nanoseconds Maximum{};
+    };
+
+    // Gets the phases that have been recorded at least once since the process started or the last reset, in phase order.
+    std::vector<PhaseSummary> GetSummary();
+
+    // Discards everything that has been recorded.
+    void Reset();
+
+    // Gets the summary as a JSON document, with the durations in milliseconds:
+    // { "phases": [ { "phase": "search", "count": 2, "totalMs": 1.5, "maxMs": 1.0 } ] }
+    std::string GetSummaryAsJson();
+}
@@ -139,6 +139,14 @@ namespace AppInstaller::YAML
             return as_dispatch(t);
         }
 
+        // Gets a view of the scalar value without copying it.
+        // The view is only valid for the lifetime of the node.
+        std::string_view as_view() const;
+
+        // Gets the scalar value without copying it.
+        // The reference is only valid for the lifetime of the node.
+        const std::string& GetScalar() const;
+
         template <typename T>
         std::optional<T> try_as() const
         {
@@ -177,9 +185,18 @@ namespace AppInstaller::YAML
         // Gets the nodes in the mapping.
         const std::multimap<Node, Node>& Mapping() const;
 
+        // Appends the node to the output in a compact binary form that can be read back without parsing YAML.
+        void WriteBinary(std::string& out) const;
+
+        // Reads a node written by WriteBinary from the start of the input, advancing the input past it.
+        static Node ReadBinary(std::string_view& input);
+
     private:
         Node(std::string_view key) : m_type(Type::Scalar), m_scalar(key), m_tagType(TagType::Str) {}
 
+        // Reads a node written by WriteBinary that is nested at the given depth; throwing if the depth is too great.
+        static Node ReadBinary(std::string_view& input, size_t depth);
+
         // Require certain node types to; throwing if the requirement is not met.
         void Require(Type type) const;
 
@@ -255,6 +272,8 @@ namespace AppInstaller::YAML
 
         const DocumentSchemaHeader& GetSchemaHeader() const { return m_schemaHeader; }
 
+        const Node& GetRoot() const& { return m_root; }
+
         // Return r-values for move semantics
         Node&& GetRoot() && { return std::move(m_root); }
 
@@ -275,6 +294,13 @@ namespace AppInstaller::YAML
     Document LoadDocument(const std::filesystem::path& input);
     Document LoadDocument(const std::filesystem::path& input, Utility::SHA256::HashBuffer& hashOut);
 
+    // Converts the document to a compact, versioned binary form.
+    std::string ConvertToBinary(const Document& document);
+
+    // Loads a document from the binary form created by ConvertToBinary.
+    // Throws APPINSTALLER_CLI_ERROR_YAML_INVALID_DATA if the input is not in the expected form or version.
+    Document LoadDocumentFromBinary(std::string_view input);
+
     // A YAML emitter.
     struct Emitter
     {
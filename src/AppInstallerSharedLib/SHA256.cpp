@@ -3,52 +3,97 @@
 #include <pch.h>
 #define WIN32_NO_STATUS
 #include <bcrypt.h>
+#include <array>
+#include <atomic>
+#include <future>
+#include <thread>
 #include "Public/AppInstallerSHA256.h"
 #include "Public/AppInstallerErrors.h"
 #include "Public/AppInstallerStrings.h"
+#include "Public/winget/Timing.h"
 
 namespace AppInstaller::Utility {
 
+    namespace
+    {
+        // The algorithm provider is expensive to open and can be shared by all hashes, including those on other threads.
+        // CNG uses the SHA instructions of the processor when they are available.
+        struct SHA256Algorithm
+        {
+            SHA256Algorithm()
+            {
+                BCRYPT_ALG_HANDLE algHandleT{};
+                DWORD resultLength = 0;
+
+                // Open an algorithm handle
+                THROW_IF_NTSTATUS_FAILED_MSG(BCryptOpenAlgorithmProvider(
+                    &algHandleT,                // Alg Handle pointer
+                    BCRYPT_SHA256_ALGORITHM,    // Cryptographic Algorithm name (null terminated unicode string)
+                    nullptr,                    // Provider name; if null, the default provider is loaded
+                    0),                         // Flags
+                    "failed opening SHA256 algorithm provider");
+                algHandle.reset(algHandleT);
+
+                // Obtain the length of the hash
+                THROW_IF_NTSTATUS_FAILED_MSG(BCryptGetProperty(
+                    algHandle.get(),                // Handle to a CNG object
+                    BCRYPT_HASH_LENGTH,             // Property name (null terminated unicode string)
+                    (PBYTE) & (hashLength),         // Address of the output buffer which receives the property value
+                    sizeof(hashLength),             // Size of the buffer in bytes
+                    &resultLength,                  // Number of bytes that were copied into the buffer
+                    0),                             // Flags
+                    "failed getting SHA256 hash length");
+
+                if (resultLength != sizeof(hashLength))
+                {
+                    THROW_HR_MSG(E_UNEXPECTED, "failed getting SHA256 hash length");
+                }
+            }
+
+            static const SHA256Algorithm& Instance()
+            {
+                static SHA256Algorithm s_instance;
+                return s_instance;
+            }
+
+            wil::unique_bcrypt_algorithm algHandle;
+            DWORD hashLength = 0;
+        };
+
+        // Hashes the files at the given paths, taking the next index to hash from nextIndex until there are none left or another worker fails.
+        void HashFiles(const std::vector<std::filesystem::path>& paths, std::vector<SHA256::HashDetails>& results, std::atomic<size_t>& nextIndex, std::atomic<bool>& failed)
+        {
+            for (size_t i = nextIndex++; i < paths.size() && !failed; i = nextIndex++)
+            {
+                try
+                {
+                    results[i] = SHA256::ComputeHashDetailsFromFile(paths[i]);
+                }
+                catch (...)
+                {
+                    failed = true;
+                    throw;
+                }
+            }
+        }
+    }
+
     struct SHA256Context
     {
-        wil::unique_bcrypt_algorithm algHandle;
         wil::unique_bcrypt_hash hashHandle;
         DWORD hashLength = 0;
     };
 
     SHA256::SHA256() : context(new SHA256Context{})
     {
-        BCRYPT_ALG_HANDLE algHandleT{};
-        BCRYPT_HASH_HANDLE hashHandleT;
-        DWORD resultLength = 0;
+        const SHA256Algorithm& algorithm = SHA256Algorithm::Instance();
+        context->hashLength = algorithm.hashLength;
 
-        // Open an algorithm handle
-        THROW_IF_NTSTATUS_FAILED_MSG(BCryptOpenAlgorithmProvider(
-            &algHandleT,                // Alg Handle pointer
-            BCRYPT_SHA256_ALGORITHM,    // Cryptographic Algorithm name (null terminated unicode string)
-            nullptr,                    // Provider name; if null, the default provider is loaded
-            0),                         // Flags
-            "failed opening SHA256 algorithm provider");
-        context->algHandle.reset(algHandleT);
-
-        // Obtain the length of the hash
-        THROW_IF_NTSTATUS_FAILED_MSG(BCryptGetProperty(
-            context->algHandle.get(),       // Handle to a CNG object
-            BCRYPT_HASH_LENGTH,             // Property name (null terminated unicode string)
-            (PBYTE) & (context->hashLength),  // Address of the output buffer which receives the property value
-            sizeof(context->hashLength),    // Size of the buffer in bytes
-            &resultLength,                  // Number of bytes that were copied into the buffer
-            0),                             // Flags
-            "failed getting SHA256 hash length");
-        
-        if (resultLength != sizeof(context->hashLength))
-        {
-            THROW_HR_MSG(E_UNEXPECTED, "failed getting SHA256 hash length");
-        }
+        BCRYPT_HASH_HANDLE hashHandleT;
 
         // Create a hash handle
         THROW_IF_NTSTATUS_FAILED_MSG(BCryptCreateHash(
-            context->algHandle.get(),   // Handle to an algorithm provider
+            algorithm.algHandle.get(),  // Handle to an algorithm provider
             &hashHandleT,               // A pointer to a hash handle - can be a hash or hmac object
             nullptr,                    // Pointer to the buffer that receives the hash/hmac object
             0,                          // Size of the buffer in bytes
@@ -132,6 +177,8 @@ namespace AppInstaller::Utility {
 
     SHA256::HashDetails SHA256::ComputeHashDetails(std::istream& in)
     {
+        Timing::ScopedTimer timer{ Timing::Phase::Hash };
+
         // Throw exceptions on badbit
         auto excState = in.exceptions();
         auto revertExcState = wil::scope_exit([excState, &in]() { in.exceptions(excState); });
@@ -169,14 +216,76 @@ namespace AppInstaller::Utility {
 
     SHA256::HashBuffer SHA256::ComputeHashFromFile(const std::filesystem::path& path)
     {
-        std::ifstream inStream{ path, std::ifstream::binary };
-        const Utility::SHA256::HashBuffer& targetFileHash = Utility::SHA256::ComputeHash(inStream);
-        inStream.close();
-        return targetFileHash;
+        return ComputeHashDetailsFromFile(path).Hash;
+    }
+
+    SHA256::HashDetails SHA256::ComputeHashDetailsFromFile(const std::filesystem::path& path)
+    {
+        // Share the file as std::ifstream does.
+        wil::unique_hfile file{ CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_OVERLAPPED | FILE_FLAG_SEQUENTIAL_SCAN, nullptr) };
+        THROW_LAST_ERROR_IF(!file);
+
+        return ComputeHashDetailsFromOverlappedHandle(file.get());
+    }
+
+    std::vector<SHA256::HashDetails> SHA256::ComputeHashDetailsFromFiles(const std::vector<std::filesystem::path>& paths, size_t maxConcurrency)
+    {
+        std::vector<HashDetails> results(paths.size());
+
+        if (maxConcurrency == 0)
+        {
+            maxConcurrency = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        }
+
+        size_t workerCount = std::min(maxConcurrency, paths.size());
+        std::atomic<size_t> nextIndex = 0;
+        std::atomic<bool> failed = false;
+        std::vector<std::future<void>> otherWorkers;
+
+        for (size_t i = 1; i < workerCount; ++i)
+        {
+            otherWorkers.emplace_back(std::async(std::launch::async, [&]() { HashFiles(paths, results, nextIndex, failed); }));
+        }
+
+        // The first worker runs on this thread; the others must finish before any failure is thrown.
+        std::exception_ptr firstFailure;
+
+        try
+        {
+            HashFiles(paths, results, nextIndex, failed);
+        }
+        catch (...)
+        {
+            firstFailure = std::current_exception();
+        }
+
+        for (auto& otherWorker : otherWorkers)
+        {
+            try
+            {
+                otherWorker.get();
+            }
+            catch (...)
+            {
+                if (!firstFailure)
+                {
+                    firstFailure = std::current_exception();
+                }
+            }
+        }
+
+        if (firstFailure)
+        {
+            std::rethrow_exception(firstFailure);
+        }
+
+        return results;
     }
 
     SHA256::HashBuffer SHA256::ComputeHashFromHandle(HANDLE fileHandle)
     {
+        Timing::ScopedTimer timer{ Timing::Phase::Hash };
+
         constexpr DWORD bufferSize = 1024 * 1024;
         auto buffer = std::make_unique<uint8_t[]>(bufferSize);
         SHA256 hasher;
@@ -190,6 +299,101 @@ namespace AppInstaller::Utility {
         return hasher.Get();
     }
 
+    SHA256::HashDetails SHA256::ComputeHashDetailsFromOverlappedHandle(HANDLE fileHandle)
+    {
+        Timing::ScopedTimer timer{ Timing::Phase::Hash };
+
+        constexpr DWORD bufferSize = 4 * 1024 * 1024;
+        constexpr size_t readCount = 2;
+
+        struct PendingRead
+        {
+            std::unique_ptr<uint8_t[]> Buffer;
+            wil::unique_event Event;
+            OVERLAPPED Overlapped{};
+            DWORD Requested = 0;
+            bool Issued = false;
+        };
+
+        LARGE_INTEGER fileSize{};
+        THROW_IF_WIN32_BOOL_FALSE(GetFileSizeEx(fileHandle, &fileSize));
+        const uint64_t totalSize = static_cast<uint64_t>(fileSize.QuadPart);
+        uint64_t nextOffset = 0;
+
+        std::array<PendingRead, readCount> reads;
+        for (PendingRead& read : reads)
+        {
+            read.Buffer = std::make_unique<uint8_t[]>(bufferSize);
+            read.Event.create(wil::EventOptions::ManualReset);
+            read.Overlapped.hEvent = read.Event.get();
+        }
+
+        // The buffers must outlive any read that is still in flight.
+        auto cancelReads = wil::scope_exit([&]()
+            {
+                for (PendingRead& read : reads)
+                {
+                    if (read.Issued)
+                    {
+                        DWORD ignored = 0;
+                        CancelIoEx(fileHandle, &read.Overlapped);
+                        GetOverlappedResult(fileHandle, &read.Overlapped, &ignored, TRUE);
+                    }
+                }
+            });
+
+        auto issueRead = [&](PendingRead& read)
+            {
+                if (nextOffset >= totalSize)
+                {
+                    return;
+                }
+
+                read.Requested = static_cast<DWORD>(std::min<uint64_t>(bufferSize, totalSize - nextOffset));
+                read.Overlapped.Offset = static_cast<DWORD>(nextOffset);
+                read.Overlapped.OffsetHigh = static_cast<DWORD>(nextOffset >> 32);
+
+                if (!ReadFile(fileHandle, read.Buffer.get(), read.Requested, nullptr, &read.Overlapped))
+                {
+                    DWORD error = GetLastError();
+                    THROW_WIN32_IF(error, error != ERROR_IO_PENDING);
+                }
+
+                read.Issued = true;
+                nextOffset += read.Requested;
+            };
+
+        for (PendingRead& read : reads)
+        {
+            issueRead(read);
+        }
+
+        // Reads are issued round robin in file order, so consuming them in the same order hashes the file in order.
+        SHA256 hasher;
+        uint64_t hashedSize = 0;
+
+        for (size_t current = 0; reads[current].Issued; current = (current + 1) % readCount)
+        {
+            PendingRead& read = reads[current];
+
+            DWORD bytesRead = 0;
+            BOOL readResult = GetOverlappedResult(fileHandle, &read.Overlapped, &bytesRead, TRUE);
+            read.Issued = false;
+            THROW_LAST_ERROR_IF(!readResult);
+            THROW_HR_IF(APPINSTALLER_CLI_ERROR_STREAM_READ_FAILURE, bytesRead != read.Requested);
+
+            hasher.Add(read.Buffer.get(), bytesRead);
+            hashedSize += bytesRead;
+
+            issueRead(read);
+        }
+
+        HashDetails result;
+        result.Hash = hasher.Get();
+        result.SizeInBytes = hashedSize;
+        return result;
+    }
+
     void SHA256::SHA256ContextDeleter::operator()(SHA256Context* context)
     {
         delete context;
@@ -0,0 +1,152 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "Public/winget/Timing.h"
+#include <array>
+#include <atomic>
+
+namespace AppInstaller::Timing
+{
+    namespace
+    {
+        struct PhaseData
+        {
+            std::atomic<uint64_t> Count{ 0 };
+            std::atomic<uint64_t> TotalNanoseconds{ 0 };
+            std::atomic<uint64_t> MaximumNanoseconds{ 0 };
+        };
+
+        std::atomic<bool> s_enabled{ false };
+        std::array<PhaseData, static_cast<size_t>(Phase::Max)> s_phaseData;
+
+        double ToMilliseconds(std::chrono::nanoseconds duration)
+        {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        }
+    }
+
+    std::string_view ToString(Phase phase)
+    {
+        switch (phase)
+        {
+        case Phase::SourceOpen: return "sourceOpen";
+        case Phase::SourceUpdate: return "sourceUpdate";
+        case Phase::Search: return "search";
+        case Phase::Correlation: return "correlation";
+        case Phase::ManifestFetch: return "manifestFetch";
+        case Phase::ManifestParse: return "manifestParse";
+        case Phase::Download: return "download";
+        case Phase::Hash: return "hash";
+        case Phase::Install: return "install";
+        }
+
+        return "unknown";
+    }
+
+    void SetEnabled(bool enabled)
+    {
+        s_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool IsEnabled()
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    void Record(Phase phase, std::chrono::steady_clock::duration duration)
+    {
+        if (!IsEnabled() || phase >= Phase::Max)
+        {
+            return;
+        }
+
+        PhaseData& data = s_phaseData[static_cast<size_t>(phase)];
+        uint64_t nanoseconds = static_cast<uint64_t>(std::max<std::chrono::nanoseconds::rep>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(), 0));
+
+        data.Count.fetch_add(1, std::memory_order_relaxed);
+        data.TotalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+        uint64_t currentMaximum = data.MaximumNanoseconds.load(std::memory_order_relaxed);
+        while (nanoseconds > currentMaximum &&
+            !data.MaximumNanoseconds.compare_exchange_weak(currentMaximum, nanoseconds, std::memory_order_relaxed));
+    }
+
+    ScopedTimer::ScopedTimer(Phase phase) : m_phase(phase)
+    {
+        if (IsEnabled())
+        {
+            m_active = true;
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ScopedTimer::~ScopedTimer()
+    {
+        Stop();
+    }
+
+    void ScopedTimer::Stop()
+    {
+        if (m_active)
+        {
+            m_active = false;
+            Record(m_phase, std::chrono::steady_clock::now() - m_start);
+        }
+    }
+
+    std::vector<PhaseSummary> GetSummary()
+    {
+        std::vector<PhaseSummary> result;
+
+        for (size_t i = 0; i < s_phaseData.size(); ++i)
+        {
+            const PhaseData& data = s_phaseData[i];
+
+            PhaseSummary summary;
+            summary.Count = data.Count.load(std::memory_order_relaxed);
+            if (summary.Count == 0)
+            {
+                continue;
+            }
+
+            summary.Phase = static_cast<Phase>(i);
+            summary.Total = std::chrono::nanoseconds{ static_cast<std::chrono::nanoseconds::rep>(data.TotalNanoseconds.load(std::memory_order_relaxed)) };
+            summary.Maximum = std::chrono::nanoseconds{ static_cast<std::chrono::nanoseconds::rep>(data.MaximumNanoseconds.load(std::memory_order_relaxed)) };
+            result.emplace_back(summary);
+        }
+
+        return result;
+    }
+
+    void Reset()
+    {
+        for (PhaseData& data : s_phaseData)
+        {
+            data.Count.store(0, std::memory_order_relaxed);
+            data.TotalNanoseconds.store(0, std::memory_order_relaxed);
+            data.MaximumNanoseconds.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::string GetSummaryAsJson()
+    {
+        Json::Value phases{ Json::ValueType::arrayValue };
+
+        for (const auto& summary : GetSummary())
+        {
+            Json::Value phase{ Json::ValueType::objectValue };
+            phase["phase"] = std::string{ ToString(summary.Phase) };
+            phase["count"] = static_cast<Json::UInt64>(summary.Count);
+            phase["totalMs"] = ToMilliseconds(summary.Total);
+            phase["maxMs"] = ToMilliseconds(summary.Maximum);
+            phases.append(std::move(phase));
+        }
+
+        Json::Value root{ Json::ValueType::objectValue };
+        root["phases"] = std::move(phases);
+
+        Json::StreamWriterBuilder writerBuilder;
+        writerBuilder.settings_["indentation"] = "  ";
+        return Json::writeString(writerBuilder, root);
+    }
+}
@@ -15,6 +15,49 @@ namespace AppInstaller::Utility
     static constexpr std::string_view s_Approximate_Less_Than = "< "sv;
     static constexpr std::string_view s_Approximate_Greater_Than = "> "sv;
 
+    namespace
+    {
+        // Markers used in the sort key; only their relative order matters.
+        constexpr uint8_t s_SortKey_Unknown = 0x00;
+        constexpr uint8_t s_SortKey_Known = 0x01;
+        constexpr uint8_t s_SortKey_Latest = 0x02;
+
+        // A part that is less than an empty part, the end of the parts (equal to empty parts), and a part greater than an empty part.
+        constexpr uint8_t s_SortKey_PartBelowEmpty = 0x01;
+        constexpr uint8_t s_SortKey_PartsEnd = 0x02;
+        constexpr uint8_t s_SortKey_PartAboveEmpty = 0x03;
+
+        // A part with other characters sorts below the same integer without them.
+        constexpr uint8_t s_SortKey_OtherPresent = 0x01;
+        constexpr uint8_t s_SortKey_OtherAbsent = 0x02;
+
+        template <typename T>
+        void AppendBigEndian(std::vector<uint8_t>& key, T value)
+        {
+            for (size_t i = sizeof(T); i > 0; --i)
+            {
+                key.push_back(static_cast<uint8_t>(value >> ((i - 1) * 8)));
+            }
+        }
+
+        // Appends the string such that a prefix orders before any longer string; embedded nulls are escaped.
+        void AppendTerminatedString(std::vector<uint8_t>& key, std::string_view value)
+        {
+            for (char c : value)
+            {
+                key.push_back(static_cast<uint8_t>(c));
+
+                if (c == '\0')
+                {
+                    key.push_back(0xFF);
+                }
+            }
+
+            key.push_back(0x00);
+            key.push_back(0x01);
+        }
+    }
+
     Version::Version(std::string&& version, std::string_view splitChars)
     {
         Assign(std::move(version), splitChars);
@@ -51,16 +94,16 @@ namespace AppInstaller::Utility
         m_version = std::move(Utility::Trim(version));
 
         // Process approximate comparator if applicable
-        std::string baseVersion = m_version;
-        if (CaseInsensitiveStartsWith(m_version, s_Approximate_Less_Than))
+        std::string_view baseVersion = m_version;
+        if (CaseInsensitiveStartsWith(baseVersion, s_Approximate_Less_Than))
         {
             m_approximateComparator = ApproximateComparator::LessThan;
-            baseVersion = m_version.substr(s_Approximate_Less_Than.length(), m_version.length() - s_Approximate_Less_Than.length());
+            baseVersion.remove_prefix(s_Approximate_Less_Than.length());
         }
-        else if (CaseInsensitiveStartsWith(m_version, s_Approximate_Greater_Than))
+        else if (CaseInsensitiveStartsWith(baseVersion, s_Approximate_Greater_Than))
         {
             m_approximateComparator = ApproximateComparator::GreaterThan;
-            baseVersion = m_version.substr(s_Approximate_Greater_Than.length(), m_version.length() - s_Approximate_Greater_Than.length());
+            baseVersion.remove_prefix(s_Approximate_Greater_Than.length());
         }
 
         // If there is a digit before the split character, or no split characters exist, trim off all leading non-digit characters
@@ -68,7 +111,7 @@ namespace AppInstaller::Utility
         size_t splitPos = baseVersion.find_first_of(splitChars);
         if (m_trimPrefix && digitPos != std::string::npos && (splitPos == std::string::npos || digitPos < splitPos))
         {
-            baseVersion.erase(0, digitPos);
+            baseVersion.remove_prefix(digitPos);
         }
 
         // Then parse the base version
@@ -101,13 +144,47 @@ namespace AppInstaller::Utility
             }
             else
             {
-                return;
+                break;
+            }
+        }
+
+        UpdateComparisonKey();
+    }
+
+    void Version::UpdateComparisonKey()
+    {
+        m_isBaseVersionLatest = (m_parts.size() == 1 && m_parts[0].Integer == 0 && Utility::CaseInsensitiveEquals(m_parts[0].Other, s_Version_Part_Latest));
+        m_isBaseVersionUnknown = (m_parts.size() == 1 && m_parts[0].Integer == 0 && Utility::CaseInsensitiveEquals(m_parts[0].Other, s_Version_Part_Unknown));
+
+        m_packedParts.fill(0);
+        m_isPacked = (m_parts.size() <= m_packedParts.size());
+
+        for (size_t i = 0; m_isPacked && i < m_parts.size(); ++i)
+        {
+            if (m_parts[i].Other.empty())
+            {
+                m_packedParts[i] = m_parts[i].Integer;
+            }
+            else
+            {
+                m_isPacked = false;
             }
         }
     }
 
     bool Version::operator<(const Version& other) const
     {
+        // Packed versions have only integer parts, so neither can be Latest or Unknown
+        if (m_isPacked && other.m_isPacked)
+        {
+            if (m_packedParts != other.m_packedParts)
+            {
+                return m_packedParts < other.m_packedParts;
+            }
+
+            return ApproximateCompareLessThan(other);
+        }
+
         // Sort Latest higher than any other values
         bool thisIsLatest = IsBaseVersionLatest();
         bool otherIsLatest = other.IsBaseVersionLatest();
@@ -181,6 +258,11 @@ namespace AppInstaller::Utility
             return false;
         }
 
+        if (m_isPacked && other.m_isPacked)
+        {
+            return m_parts.size() == other.m_parts.size() && m_packedParts == other.m_packedParts;
+        }
+
         if ((IsBaseVersionLatest() && other.IsBaseVersionLatest()) ||
             (IsBaseVersionUnknown() && other.IsBaseVersionUnknown()))
         {
@@ -218,6 +300,7 @@ namespace AppInstaller::Utility
         Version result;
         result.m_version = s_Version_Part_Latest;
         result.m_parts.emplace_back(0, std::string{ s_Version_Part_Latest });
+        result.UpdateComparisonKey();
         return result;
     }
 
@@ -231,6 +314,7 @@ namespace AppInstaller::Utility
         Version result;
         result.m_version = s_Version_Part_Unknown;
         result.m_parts.emplace_back(0, std::string{ s_Version_Part_Unknown });
+        result.UpdateComparisonKey();
         return result;
     }
 
@@ -264,14 +348,72 @@ namespace AppInstaller::Utility
         return baseVersion;
     }
     
-    bool Version::IsBaseVersionLatest() const
+    std::vector<uint8_t> Version::GetSortKey() const
     {
-        return (m_parts.size() == 1 && m_parts[0].Integer == 0 && Utility::CaseInsensitiveEquals(m_parts[0].Other, s_Version_Part_Latest));
-    }
+        std::vector<uint8_t> result;
 
-    bool Version::IsBaseVersionUnknown() const
-    {
-        return (m_parts.size() == 1 && m_parts[0].Integer == 0 && Utility::CaseInsensitiveEquals(m_parts[0].Other, s_Version_Part_Unknown));
+        if (IsBaseVersionUnknown())
+        {
+            result.push_back(s_SortKey_Unknown);
+        }
+        else if (IsBaseVersionLatest())
+        {
+            result.push_back(s_SortKey_Latest);
+        }
+        else
+        {
+            result.push_back(s_SortKey_Known);
+
+            // Versions compare as if the shorter one were padded with empty parts, so empty parts are not written individually.
+            // Instead, each non-empty part is written with the number of empty parts before it. The side with fewer of them
+            // compares its part against an empty part on the other side first, which decides the order based on whether that
+            // part is above or below an empty part.
+            uint32_t emptyPartCount = 0;
+
+            for (const Part& part : m_parts)
+            {
+                if (part.Integer == 0 && part.Other.empty())
+                {
+                    ++emptyPartCount;
+                    continue;
+                }
+
+                bool isAboveEmpty = (part.Integer != 0);
+                result.push_back(isAboveEmpty ? s_SortKey_PartAboveEmpty : s_SortKey_PartBelowEmpty);
+                AppendBigEndian(result, isAboveEmpty ? ~emptyPartCount : emptyPartCount);
+                AppendBigEndian(result, part.Integer);
+
+                if (part.Other.empty())
+                {
+                    result.push_back(s_SortKey_OtherAbsent);
+                }
+                else
+                {
+                    result.push_back(s_SortKey_OtherPresent);
+                    AppendTerminatedString(result, Utility::FoldCase(static_cast<std::string_view>(part.Other)));
+                }
+
+                emptyPartCount = 0;
+            }
+
+            result.push_back(s_SortKey_PartsEnd);
+        }
+
+        // Approximate versions sort just below or above the base version
+        switch (m_approximateComparator)
+        {
+        case ApproximateComparator::LessThan:
+            result.push_back(0x00);
+            break;
+        case ApproximateComparator::None:
+            result.push_back(0x01);
+            break;
+        case ApproximateComparator::GreaterThan:
+            result.push_back(0x02);
+            break;
+        }
+
+        return result;
     }
 
     bool Version::ApproximateCompareLessThan(const Version& other) const
@@ -281,25 +423,50 @@ namespace AppInstaller::Utility
             (m_approximateComparator == ApproximateComparator::None && other.m_approximateComparator == ApproximateComparator::GreaterThan);
     }
 
-    Version::Part::Part(const std::string& part)
+    Version::Part::Part(std::string_view part)
     {
-        std::string interimPart = Utility::Trim(part);
-        const char* begin = interimPart.c_str();
-        char* end = nullptr;
-        errno = 0;
-        Integer = strtoull(begin, &end, 10);
+        Utility::Trim(part);
+
+        // Parse leading digits directly when there are few enough that they cannot overflow; this is the common case.
+        constexpr size_t maxDigitsWithoutOverflow = std::numeric_limits<uint64_t>::digits10;
+        size_t digitCount = 0;
+        uint64_t integer = 0;
 
-        if (errno == ERANGE)
+        while (digitCount < part.length() && digitCount <= maxDigitsWithoutOverflow && part[digitCount] >= '0' && part[digitCount] <= '9')
         {
-            Integer = 0;
-            Other = interimPart;
+            integer = integer * 10 + static_cast<uint64_t>(part[digitCount] - '0');
+            ++digitCount;
         }
-        else if (static_cast<size_t>(end - begin) != interimPart.length())
+
+        if (digitCount > 0 && digitCount <= maxDigitsWithoutOverflow)
         {
-            Other = end;
+            Integer = integer;
+            Other = part.substr(digitCount);
         }
+        else
+        {
+            // Leave signs, whitespace and large values to the C runtime
+            std::string interimPart{ part };
+            const char* begin = interimPart.c_str();
+            char* end = nullptr;
+            errno = 0;
+            Integer = strtoull(begin, &end, 10);
 
-        m_foldedOther = Utility::FoldCase(static_cast<std::string_view>(Other));
+            if (errno == ERANGE)
+            {
+                Integer = 0;
+                Other = interimPart;
+            }
+            else if (static_cast<size_t>(end - begin) != interimPart.length())
+            {
+                Other = end;
+            }
+        }
+
+        if (!Other.empty())
+        {
+            m_foldedOther = Utility::FoldCase(static_cast<std::string_view>(Other));
+        }
     }
 
     Version::Part::Part(uint64_t integer, std::string other) :
@@ -507,6 +674,7 @@ namespace AppInstaller::Utility
                 m_parts.emplace_back();
             }
             m_parts[2].Other = version.substr(otherSplit);
+            UpdateComparisonKey();
         }
 
         // Overwrite the whole version string with our whole version string
@@ -713,6 +881,7 @@ namespace AppInstaller::Utility
         {
             m_version = s_Version_Part_Unknown;
             m_parts.emplace_back(0, std::string{ s_Version_Part_Unknown });
+            UpdateComparisonKey();
         }
     }
 }
@@ -128,6 +128,60 @@ namespace AppInstaller::YAML
 
             return {};
         }
+
+        // The binary form starts with this tag and version; change the version whenever the layout changes.
+        static constexpr std::string_view s_binaryFormatTag = "WGYB"sv;
+        static constexpr uint32_t s_binaryFormatVersion = 1;
+
+        // The deepest nesting of nodes that will be read from the binary form, well beyond that of any manifest.
+        static constexpr size_t s_binaryMaximumDepth = 64;
+
+        void WriteBinaryValue(std::string& out, uint32_t value)
+        {
+            char bytes[sizeof(value)];
+            memcpy(bytes, &value, sizeof(value));
+            out.append(bytes, sizeof(value));
+        }
+
+        void WriteBinaryValue(std::string& out, std::string_view value)
+        {
+            WriteBinaryValue(out, static_cast<uint32_t>(value.size()));
+            out.append(value);
+        }
+
+        void WriteBinaryValue(std::string& out, const Mark& mark)
+        {
+            WriteBinaryValue(out, static_cast<uint32_t>(mark.line));
+            WriteBinaryValue(out, static_cast<uint32_t>(mark.column));
+        }
+
+        std::string_view ReadBinaryBytes(std::string_view& input, size_t count)
+        {
+            THROW_HR_IF(APPINSTALLER_CLI_ERROR_YAML_INVALID_DATA, input.size() < count);
+            std::string_view result = input.substr(0, count);
+            input.remove_prefix(count);
+            return result;
+        }
+
+        uint32_t ReadBinaryUInt32(std::string_view& input)
+        {
+            uint32_t result = 0;
+            memcpy(&result, ReadBinaryBytes(input, sizeof(result)).data(), sizeof(result));
+            return result;
+        }
+
+        std::string ReadBinaryString(std::string_view& input)
+        {
+            uint32_t size = ReadBinaryUInt32(input);
+            return std::string{ ReadBinaryBytes(input, size) };
+        }
+
+        Mark ReadBinaryMark(std::string_view& input)
+        {
+            size_t line = ReadBinaryUInt32(input);
+            size_t column = ReadBinaryUInt32(input);
+            return { line, column };
+        }
     }
 
     Exception::Exception(Type type) :
@@ -406,11 +460,96 @@ namespace AppInstaller::YAML
         return m_mapping.value();
     }
 
+    void Node::WriteBinary(std::string& out) const
+    {
+        out.push_back(static_cast<char>(m_type));
+        out.push_back(static_cast<char>(m_tagType));
+        WriteBinaryValue(out, m_tag);
+        WriteBinaryValue(out, m_mark);
+
+        switch (m_type)
+        {
+        case Type::Scalar:
+            WriteBinaryValue(out, m_scalar);
+            break;
+        case Type::Sequence:
+            WriteBinaryValue(out, static_cast<uint32_t>(m_sequence->size()));
+            for (const auto& node : *m_sequence)
+            {
+                node.WriteBinary(out);
+            }
+            break;
+        case Type::Mapping:
+            WriteBinaryValue(out, static_cast<uint32_t>(m_mapping->size()));
+            for (const auto& keyValuePair : *m_mapping)
+            {
+                keyValuePair.first.WriteBinary(out);
+                keyValuePair.second.WriteBinary(out);
+            }
+            break;
+        }
+    }
+
+    Node Node::ReadBinary(std::string_view& input)
+    {
+        return ReadBinary(input, 0);
+    }
+
+    Node Node::ReadBinary(std::string_view& input, size_t depth)
+    {
+        THROW_HR_IF(APPINSTALLER_CLI_ERROR_YAML_INVALID_DATA, depth > s_binaryMaximumDepth);
+
+        std::string_view typeBytes = ReadBinaryBytes(input, 2);
+        auto type = static_cast<Type>(static_cast<uint8_t>(typeBytes[0]));
+        auto tagType = static_cast<TagType>(static_cast<uint8_t>(typeBytes[1]));
+        THROW_HR_IF(APPINSTALLER_CLI_ERROR_YAML_INVALID_DATA, type > Type::Mapping || tagType > TagType::Map);
+
+        std::string tag = ReadBinaryString(input);
+        YAML::Mark mark = ReadBinaryMark(input);
+
+        Node result{ type, std::move(tag), mark };
+        result.m_tagType = tagType;
+
+        switch (type)
+        {
+        case Type::Scalar:
+            result.m_scalar = ReadBinaryString(input);
+            break;
+        case Type::Sequence:
+            for (uint32_t count = ReadBinaryUInt32(input); count > 0; --count)
+            {
+                result.m_sequence->emplace_back(ReadBinary(input, depth + 1));
+            }
+            break;
+        case Type::Mapping:
+            for (uint32_t count = ReadBinaryUInt32(input); count > 0; --count)
+            {
+                Node key = ReadBinary(input, depth + 1);
+                result.m_mapping->emplace(std::move(key), ReadBinary(input, depth + 1));
+            }
+            break;
+        }
+
+        return result;
+    }
+
     void Node::Require(Type type) const
     {
         THROW_HR_IF(APPINSTALLER_CLI_ERROR_YAML_INVALID_OPERATION, m_type != type);
     }
 
+    std::string_view Node::as_view() const
+    {
+        Require(Type::Scalar);
+        return m_scalar;
+    }
+
+    const std::string& Node::GetScalar() const
+    {
+        Require(Type::Scalar);
+        return m_scalar;
+    }
+
     std::string Node::as_dispatch(std::string*) const
     {
         return m_scalar;
@@ -690,6 +829,29 @@ namespace AppInstaller::YAML
         return LoadDocument(input, &hashOut);
     }
 
+    std::string ConvertToBinary(const Document& document)
+    {
+        std::string result{ s_binaryFormatTag };
+        WriteBinaryValue(result, s_binaryFormatVersion);
+        WriteBinaryValue(result, document.GetSchemaHeader().SchemaHeader);
+        WriteBinaryValue(result, document.GetSchemaHeader().Mark);
+        document.GetRoot().WriteBinary(result);
+        return result;
+    }
+
+    Document LoadDocumentFromBinary(std::string_view input)
+    {
+        THROW_HR_IF(APPINSTALLER_CLI_ERROR_YAML_INVALID_DATA, ReadBinaryBytes(input, s_binaryFormatTag.size()) != s_binaryFormatTag);
+        THROW_HR_IF(APPINSTALLER_CLI_ERROR_YAML_INVALID_DATA, ReadBinaryUInt32(input) != s_binaryFormatVersion);
+
+        std::string schemaHeader = ReadBinaryString(input);
+        YAML::Mark schemaHeaderMark = ReadBinaryMark(input);
+        Node root = Node::ReadBinary(input);
+        THROW_HR_IF(APPINSTALLER_CLI_ERROR_YAML_INVALID_DATA, !input.empty());
+
+        return { std::move(root), DocumentSchemaHeader{ std::move(schemaHeader), schemaHeaderMark } };
+    }
+
     Emitter::Emitter() :
         m_document(std::make_unique<Wrapper::Document>(true))
     {